@@ -1,7 +1,6 @@
 #pragma once
 
 #include "../../game-lib/include/powerup/PowerupRegistry.hpp"
-#include "common/SafeQueue.hpp"
 #include "input/InputHandler.hpp"
 #include "level/CustomLevelConfig.hpp"
 #include "managers/Managers.hpp"
@@ -23,8 +22,8 @@ private:
     static constexpr unsigned int WINDOW_HEIGHT = 1080;
     static constexpr unsigned int FRAMERATE = 60;
 
-    ThreadSafeQueue<GameToNetwork::Message>& game_to_network_queue_;
-    ThreadSafeQueue<NetworkToGame::Message>& network_to_game_queue_;
+    GameToNetworkQueue& game_to_network_queue_;
+    NetworkToGameQueue& network_to_game_queue_;
 
     sf::RenderWindow& window_;
     sf::Font font_;
@@ -113,8 +112,8 @@ public:
     bool should_return_to_menu() const { return m_request_return_to_menu; }
 
 public:
-    Game(sf::RenderWindow& window, ThreadSafeQueue<GameToNetwork::Message>& game_to_net,
-         ThreadSafeQueue<NetworkToGame::Message>& net_to_game);
+    Game(sf::RenderWindow& window, GameToNetworkQueue& game_to_net,
+         NetworkToGameQueue& net_to_game);
     ~Game();
 
     void run();
@@ -1,7 +1,9 @@
 #pragma once
 
+#include "../../src/Common/RingBuffer.hpp"
 #include "game/Entity.hpp"
 
+#include <cstddef>
 #include <cstdint>
 
 #include <map>
@@ -185,3 +187,16 @@ struct Message {
     }
 };
 }  // namespace NetworkToGame
+
+// Both directions take pushes from more than one thread: the network thread
+// queues its own Disconnect, and LobbyState re-queues messages it postpones.
+using GameToNetworkQueue = RType::MpscRing<GameToNetwork::Message>;
+using NetworkToGameQueue = RType::MpscRing<NetworkToGame::Message>;
+
+// The rings drop on full, so they are sized for the longest stall we expect to
+// ride out. The server sends ~35 messages/s (30 Hz snapshots plus lobby and
+// level status), so the inbound ring covers several seconds of a frozen render
+// thread even with fragmented snapshots. Outbound traffic is at most a few
+// messages per frame and the send thread drains it continuously.
+inline constexpr std::size_t NETWORK_TO_GAME_QUEUE_CAPACITY = 8192;
+inline constexpr std::size_t GAME_TO_NETWORK_QUEUE_CAPACITY = 2048;
@@ -2,7 +2,6 @@
 
 #include "../../src/Common/BinarySerializer.hpp"
 #include "../../src/Common/Opcodes.hpp"
-#include "common/SafeQueue.hpp"
 #include "game/Entity.hpp"
 #include "network/Messages.hpp"
 
@@ -29,19 +28,22 @@ private:
     std::atomic<bool> running_;
     std::thread network_thread_;
 
-    ThreadSafeQueue<GameToNetwork::Message>& game_to_network_queue_;
-    ThreadSafeQueue<NetworkToGame::Message>& network_to_game_queue_;
+    GameToNetworkQueue& game_to_network_queue_;
+    NetworkToGameQueue& network_to_game_queue_;
+    uint64_t reported_inbound_drops_ = 0;
+    uint64_t reported_outbound_drops_ = 0;
 
     uint32_t my_network_id_ = 0;
     std::chrono::steady_clock::time_point start_time_;
 
     void start_receive();
     void handle_receive(std::error_code ec, std::size_t bytes_received);
+    void report_queue_drops();
 
 public:
     NetworkClient(const std::string& host, unsigned short port,
-                  ThreadSafeQueue<GameToNetwork::Message>& game_to_net,
-                  ThreadSafeQueue<NetworkToGame::Message>& net_to_game);
+                  GameToNetworkQueue& game_to_net,
+                  NetworkToGameQueue& net_to_game);
 
     void receive_loop();
     void send_loop();
@@ -1,6 +1,5 @@
 #pragma once
 
-#include "common/SafeQueue.hpp"
 #include "game/Game.hpp"
 #include "network/Messages.hpp"
 #include "network/NetworkClient.hpp"
@@ -16,8 +15,8 @@ namespace rtype {
 class GameState : public IState {
 public:
     GameState(sf::RenderWindow& window,
-              std::shared_ptr<ThreadSafeQueue<GameToNetwork::Message>> game_to_net,
-              std::shared_ptr<ThreadSafeQueue<NetworkToGame::Message>> net_to_game);
+              std::shared_ptr<GameToNetworkQueue> game_to_net,
+              std::shared_ptr<NetworkToGameQueue> net_to_game);
     ~GameState() override;
 
     void on_enter() override;
@@ -32,8 +31,8 @@ private:
     sf::RenderWindow& m_window;
     std::string m_next_state;
 
-    std::shared_ptr<ThreadSafeQueue<GameToNetwork::Message>> m_game_to_network_queue;
-    std::shared_ptr<ThreadSafeQueue<NetworkToGame::Message>> m_network_to_game_queue;
+    std::shared_ptr<GameToNetworkQueue> m_game_to_network_queue;
+    std::shared_ptr<NetworkToGameQueue> m_network_to_game_queue;
 
     std::unique_ptr<Game> m_game;
 };
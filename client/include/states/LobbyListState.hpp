@@ -1,6 +1,5 @@
 #pragma once
 
-#include "common/SafeQueue.hpp"
 #include "network/Messages.hpp"
 #include "states/IState.hpp"
 #include "ui/MenuComponents.hpp"
@@ -26,8 +25,8 @@ struct LobbyInfo {
 class LobbyListState : public IState {
 public:
     LobbyListState(sf::RenderWindow& window,
-                   std::shared_ptr<ThreadSafeQueue<GameToNetwork::Message>> game_to_net,
-                   std::shared_ptr<ThreadSafeQueue<NetworkToGame::Message>> net_to_game);
+                   std::shared_ptr<GameToNetworkQueue> game_to_net,
+                   std::shared_ptr<NetworkToGameQueue> net_to_game);
     ~LobbyListState() override;
 
     void on_enter() override;
@@ -54,8 +53,8 @@ private:
     sf::RenderWindow& m_window;
     std::string m_next_state;
 
-    std::shared_ptr<ThreadSafeQueue<GameToNetwork::Message>> m_game_to_network_queue;
-    std::shared_ptr<ThreadSafeQueue<NetworkToGame::Message>> m_network_to_game_queue;
+    std::shared_ptr<GameToNetworkQueue> m_game_to_network_queue;
+    std::shared_ptr<NetworkToGameQueue> m_network_to_game_queue;
 
     std::unique_ptr<ui::MenuBackground> m_background;
     std::unique_ptr<ui::MenuTitle> m_title;
@@ -1,6 +1,5 @@
 #pragma once
 
-#include "common/SafeQueue.hpp"
 #include "network/Messages.hpp"
 #include "network/NetworkClient.hpp"
 #include "states/IState.hpp"
@@ -17,8 +16,8 @@ namespace rtype {
 class LobbyState : public IState {
 public:
     LobbyState(sf::RenderWindow& window,
-               std::shared_ptr<ThreadSafeQueue<GameToNetwork::Message>> game_to_net,
-               std::shared_ptr<ThreadSafeQueue<NetworkToGame::Message>> net_to_game);
+               std::shared_ptr<GameToNetworkQueue> game_to_net,
+               std::shared_ptr<NetworkToGameQueue> net_to_game);
     ~LobbyState() override;
 
     void on_enter() override;
@@ -43,8 +42,8 @@ private:
     sf::RenderWindow& m_window;
     std::string m_next_state;
 
-    std::shared_ptr<ThreadSafeQueue<GameToNetwork::Message>> m_game_to_network_queue;
-    std::shared_ptr<ThreadSafeQueue<NetworkToGame::Message>> m_network_to_game_queue;
+    std::shared_ptr<GameToNetworkQueue> m_game_to_network_queue;
+    std::shared_ptr<NetworkToGameQueue> m_network_to_game_queue;
 
     std::unique_ptr<ui::MenuBackground> m_background;
     std::unique_ptr<ui::MenuTitle> m_title;
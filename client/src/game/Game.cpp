@@ -14,8 +14,8 @@
 #include <memory>
 #include <string>
 
-Game::Game(sf::RenderWindow& window, ThreadSafeQueue<GameToNetwork::Message>& game_to_net,
-           ThreadSafeQueue<NetworkToGame::Message>& net_to_game)
+Game::Game(sf::RenderWindow& window, GameToNetworkQueue& game_to_net,
+           NetworkToGameQueue& net_to_game)
     : window_(window),
       game_to_network_queue_(game_to_net),
       network_to_game_queue_(net_to_game),
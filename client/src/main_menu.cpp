@@ -1,5 +1,4 @@
 #include "../../game-lib/include/powerup/PowerupRegistry.hpp"
-#include "common/SafeQueue.hpp"
 #include "network/Messages.hpp"
 #include "network/NetworkClient.hpp"
 #include "rendering/ColorBlindShader.hpp"
@@ -54,8 +53,10 @@ int main(int argc, char* argv[]) {
         }
 
         std::cout << "[main] Connecting to server " << host << ":" << port << std::endl;
-        auto game_to_network_queue = std::make_shared<ThreadSafeQueue<GameToNetwork::Message>>();
-        auto network_to_game_queue = std::make_shared<ThreadSafeQueue<NetworkToGame::Message>>();
+        auto game_to_network_queue =
+            std::make_shared<GameToNetworkQueue>(GAME_TO_NETWORK_QUEUE_CAPACITY);
+        auto network_to_game_queue =
+            std::make_shared<NetworkToGameQueue>(NETWORK_TO_GAME_QUEUE_CAPACITY);
 
         std::cout << "[main] Connecting to server..." << std::endl;
         auto network_client = std::make_shared<NetworkClient>(host, port, *game_to_network_queue,
@@ -3,8 +3,8 @@
 #include "../../src/Common/CompressionSerializer.hpp"
 
 NetworkClient::NetworkClient(const std::string& host, unsigned short port,
-                             ThreadSafeQueue<GameToNetwork::Message>& game_to_net,
-                             ThreadSafeQueue<NetworkToGame::Message>& net_to_game)
+                             GameToNetworkQueue& game_to_net,
+                             NetworkToGameQueue& net_to_game)
     : io_context_(),
       socket_(io_context_),
       running_(true),
@@ -122,11 +122,28 @@ void NetworkClient::handle_receive(std::error_code ec, std::size_t bytes_receive
         }
     }
 
+    report_queue_drops();
+
     if (running_) {
         start_receive();
     }
 }
 
+void NetworkClient::report_queue_drops() {
+    uint64_t inbound = network_to_game_queue_.dropped();
+    if (inbound != reported_inbound_drops_) {
+        std::cerr << "[NetworkClient] Network-to-game queue full, dropped "
+                  << (inbound - reported_inbound_drops_) << " messages" << std::endl;
+        reported_inbound_drops_ = inbound;
+    }
+    uint64_t outbound = game_to_network_queue_.dropped();
+    if (outbound != reported_outbound_drops_) {
+        std::cerr << "[NetworkClient] Game-to-network queue full, dropped "
+                  << (outbound - reported_outbound_drops_) << " messages" << std::endl;
+        reported_outbound_drops_ = outbound;
+    }
+}
+
 void NetworkClient::receive_loop() {}
 
 void NetworkClient::send_loop() {
@@ -5,8 +5,8 @@
 namespace rtype {
 
 GameState::GameState(sf::RenderWindow& window,
-                     std::shared_ptr<ThreadSafeQueue<GameToNetwork::Message>> game_to_net,
-                     std::shared_ptr<ThreadSafeQueue<NetworkToGame::Message>> net_to_game)
+                     std::shared_ptr<GameToNetworkQueue> game_to_net,
+                     std::shared_ptr<NetworkToGameQueue> net_to_game)
     : m_window(window),
       m_game_to_network_queue(game_to_net),
       m_network_to_game_queue(net_to_game) {}
@@ -13,8 +13,8 @@
 namespace rtype {
 
 LobbyState::LobbyState(sf::RenderWindow& window,
-                       std::shared_ptr<ThreadSafeQueue<GameToNetwork::Message>> game_to_net,
-                       std::shared_ptr<ThreadSafeQueue<NetworkToGame::Message>> net_to_game)
+                       std::shared_ptr<GameToNetworkQueue> game_to_net,
+                       std::shared_ptr<NetworkToGameQueue> net_to_game)
     : m_window(window),
       m_game_to_network_queue(game_to_net),
       m_network_to_game_queue(net_to_game) {}
@@ -295,8 +295,10 @@ void LobbyState::process_network_messages() {
         }
     }
 
-    for (const auto& postponed_msg : postponed_messages) {
-        m_network_to_game_queue->push(postponed_msg);
+    for (auto& postponed_msg : postponed_messages) {
+        if (!m_network_to_game_queue->push(std::move(postponed_msg))) {
+            std::cerr << "[LobbyState] Network queue full, lost a postponed message" << std::endl;
+        }
     }
 }
 
@@ -11,6 +11,7 @@ class RTypeConan(ConanFile):
             self.requires("sfml/2.6.1")
         self.requires("boost/1.86.0")
         self.requires("gtest/1.14.0")
+        self.requires("benchmark/1.8.3")
         self.requires("lz4/1.9.4")
         self.requires("nlohmann_json/3.11.3")
 
@@ -0,0 +1,41 @@
+#include "CommandBuffer.hpp"
+
+namespace engine {
+
+void CommandBuffer::kill(entity e) {
+    auto it = std::lower_bound(_pending_kills.begin(), _pending_kills.end(), e);
+    if (it != _pending_kills.end() && *it == e) {
+        return;
+    }
+    _pending_kills.insert(it, e);
+    _commands.emplace_back([e](registry& reg) { reg.kill_entity(e); });
+}
+
+void CommandBuffer::spawn(std::function<void(registry&, entity)> init) {
+    _commands.emplace_back([init = std::move(init)](registry& reg) {
+        entity e = reg.spawn_entity();
+        if (init) {
+            init(reg, e);
+        }
+    });
+}
+
+void CommandBuffer::defer(Command command) {
+    _commands.push_back(std::move(command));
+}
+
+void CommandBuffer::flush(registry& reg) {
+    // Index loop: a command may record further commands into this buffer.
+    for (std::size_t i = 0; i < _commands.size(); ++i) {
+        Command command = std::move(_commands[i]);
+        command(reg);
+    }
+    clear();
+}
+
+void CommandBuffer::clear() {
+    _commands.clear();
+    _pending_kills.clear();
+}
+
+}  // namespace engine
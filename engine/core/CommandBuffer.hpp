@@ -0,0 +1,97 @@
+#pragma once
+
+#include "../ecs/registry.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace engine {
+
+/**
+ * @brief Records structural registry changes and plays them back later.
+ *
+ * Systems that spawn, kill or add/remove components while iterating pools
+ * record the change here instead, so no pool is resized under a live
+ * reference. The SystemManager flushes the buffer at its sync points (after
+ * each system); commands are applied in the order they were recorded.
+ *
+ * Component changes aimed at an entity that is pending kill are dropped when
+ * recorded, and any that find their target dead on flush are skipped.
+ */
+class CommandBuffer {
+public:
+    using Command = std::function<void(registry&)>;
+
+    CommandBuffer() = default;
+
+    /**
+     * @brief Kill @p e on flush. Killing the same entity twice is harmless.
+     */
+    void kill(entity e);
+
+    /**
+     * @brief True if kill(@p e) was recorded since the last flush.
+     * Lets a system skip entities it already destroyed this tick.
+     */
+    bool is_pending_kill(entity e) const {
+        return std::binary_search(_pending_kills.begin(), _pending_kills.end(), e);
+    }
+
+    template <typename Component>
+    void add_component(entity e, Component&& component) {
+        using ComponentType = std::remove_cvref_t<Component>;
+        if (is_pending_kill(e)) {
+            return;
+        }
+        _commands.emplace_back(
+            [e, value = ComponentType(std::forward<Component>(component))](registry& reg) mutable {
+                if (reg.is_alive(e)) {
+                    reg.add_component(e, std::move(value));
+                }
+            });
+    }
+
+    template <typename Component, typename... Params>
+    void emplace_component(entity e, Params&&... params) {
+        add_component(e, Component(std::forward<Params>(params)...));
+    }
+
+    template <typename Component>
+    void remove_component(entity e) {
+        if (is_pending_kill(e)) {
+            return;
+        }
+        _commands.emplace_back([e](registry& reg) { reg.remove_component<Component>(e); });
+    }
+
+    /**
+     * @brief Spawn an entity on flush and hand it to @p init to attach components.
+     */
+    void spawn(std::function<void(registry&, entity)> init);
+
+    /**
+     * @brief Run an arbitrary structural operation (e.g. an entity factory) on flush.
+     */
+    void defer(Command command);
+
+    /**
+     * @brief Apply every recorded command to @p reg, then clear the buffer.
+     * Commands recorded while flushing are applied in the same pass.
+     */
+    void flush(registry& reg);
+
+    void clear();
+
+    bool empty() const noexcept { return _commands.empty(); }
+    std::size_t size() const noexcept { return _commands.size(); }
+
+private:
+    std::vector<Command> _commands;
+    // Sorted; cleared (capacity kept) on flush so steady-state kills do not allocate.
+    std::vector<entity> _pending_kills;
+};
+
+}  // namespace engine
@@ -10,6 +10,16 @@ void GameEngine::register_system(std::unique_ptr<ISystem> system) {
     _system_manager.register_system(std::move(system));
 }
 
+void GameEngine::set_thread_pool(ThreadPool* pool) {
+    _system_manager.set_thread_pool(pool);
+    if (pool == nullptr) {
+        _registry.set_parallel_executor(nullptr);
+        return;
+    }
+    _registry.set_parallel_executor(
+        [pool](size_t count, const std::function<void(size_t)>& fn) { pool->parallel_for(count, fn); });
+}
+
 void GameEngine::init() {
     _system_manager.init_all(_registry);
 }
@@ -38,6 +38,13 @@ public:
      */
     void register_system(std::unique_ptr<ISystem> system);
 
+    /**
+     * @brief Run independent systems, and registry::parallel_each chunks, on @p pool.
+     * nullptr (the default) keeps everything sequential.
+     * @param pool Pool shared with other engines; must outlive this engine.
+     */
+    void set_thread_pool(ThreadPool* pool);
+
     /**
      * @brief Initialize all systems.
      */
@@ -54,6 +61,16 @@ public:
      */
     void shutdown();
 
+    /**
+     * @brief Per-system profiling data, see SystemManager::stats().
+     */
+    std::vector<SystemStats> get_system_stats() const { return _system_manager.stats(); }
+
+    /**
+     * @brief Dump recent system updates as Chrome trace JSON, see SystemManager::write_chrome_trace().
+     */
+    bool write_chrome_trace(const std::string& path) const { return _system_manager.write_chrome_trace(path); }
+
 private:
     registry _registry;
     SystemManager _system_manager;
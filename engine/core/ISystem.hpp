@@ -1,6 +1,8 @@
 #pragma once
 
 #include "../ecs/registry.hpp"
+#include "CommandBuffer.hpp"
+#include "SystemAccess.hpp"
 
 namespace engine {
 
@@ -27,6 +29,26 @@ public:
      */
     virtual void update(registry& reg, float dt) = 0;
 
+    /**
+     * @brief Update variant used by the SystemManager.
+     * Systems that make structural changes while iterating record them into
+     * @p commands; the manager plays them back once this system returns.
+     * Defaults to update(reg, dt).
+     * @param reg Reference to the ECS registry.
+     * @param dt Delta time since last update (seconds).
+     * @param commands Buffer flushed at the next sync point.
+     */
+    virtual void update_deferred(registry& reg, float dt, CommandBuffer& commands) {
+        (void)commands;
+        update(reg, dt);
+    }
+
+    /**
+     * @brief Components this system touches, used for parallel scheduling.
+     * Defaults to exclusive access (the system always runs alone).
+     */
+    virtual SystemAccess access() const { return SystemAccess(); }
+
     /**
      * @brief Cleanup/shutdown the system (called once before destruction).
      * @param reg Reference to the ECS registry.
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "../ecs/component_signature.hpp"
+#include "../ecs/registry.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace engine {
+
+/**
+ * @brief Components a system reads and writes in place during its update.
+ *
+ * Used by the SystemManager to decide which systems may run concurrently: two
+ * systems conflict when one writes a component the other reads or writes.
+ * Structural changes (spawn, kill, add/remove component) must go through the
+ * system's CommandBuffer; they become visible from the next stage on.
+ *
+ * A default-constructed access is exclusive: the system conflicts with every
+ * other one and runs alone, which is what systems that touch the registry
+ * directly must keep.
+ *
+ * Usage:
+ *   return SystemAccess().reads<velocity>().writes<position>();
+ */
+class SystemAccess {
+public:
+    SystemAccess() = default;
+
+    template <typename... Components>
+    SystemAccess& reads() {
+        _exclusive = false;
+        (declare<Components>(_reads), ...);
+        return *this;
+    }
+
+    template <typename... Components>
+    SystemAccess& writes() {
+        _exclusive = false;
+        (declare<Components>(_writes), ...);
+        return *this;
+    }
+
+    bool is_exclusive() const noexcept { return _exclusive; }
+
+    bool conflicts_with(SystemAccess const& other) const noexcept {
+        if (_exclusive || other._exclusive) {
+            return true;
+        }
+        return _writes.intersects(other._writes) || _writes.intersects(other._reads) ||
+               other._writes.intersects(_reads);
+    }
+
+    /**
+     * @brief Register every declared pool, so no worker registers one mid-stage.
+     */
+    void register_pools(registry& reg) const {
+        for (auto registrar : _registrars) {
+            registrar(reg);
+        }
+    }
+
+    /**
+     * @brief Upper bound on the entities one update visits: the largest declared
+     * pool, or every live entity for an exclusive system.
+     */
+    std::size_t entities_touched(registry const& reg) const noexcept {
+        if (_exclusive) {
+            return reg.alive_count();
+        }
+        std::size_t touched = 0;
+        auto widest = [&](registry::component_id id) { touched = std::max(touched, reg.pool_size(id)); };
+        _reads.for_each_set(widest);
+        _writes.for_each_set(widest);
+        return touched;
+    }
+
+private:
+    template <typename Component>
+    void declare(component_signature& set) {
+        set.set(component_type_id<Component>());
+        _registrars.push_back([](registry& reg) { reg.register_component<Component>(); });
+    }
+
+    component_signature _reads;
+    component_signature _writes;
+    std::vector<void (*)(registry&)> _registrars;
+    bool _exclusive = true;
+};
+
+}  // namespace engine
@@ -1,9 +1,15 @@
 #include "SystemManager.hpp"
 
+#include <algorithm>
+#include <typeinfo>
+
 namespace engine {
 
 void SystemManager::register_system(std::unique_ptr<ISystem> system) {
+    _profiler.add_system(SystemProfiler::type_name(typeid(*system)));
     _systems.push_back(std::move(system));
+    _commands.emplace_back();
+    _schedule_dirty = true;
 }
 
 void SystemManager::init_all(registry& reg) {
@@ -13,8 +19,15 @@ void SystemManager::init_all(registry& reg) {
 }
 
 void SystemManager::update_all(registry& reg, float dt) {
-    for (auto& system : _systems) {
-        system->update(reg, dt);
+    const auto& schedule = stages(reg);
+    if (_thread_pool == nullptr || _thread_pool->worker_count() == 0) {
+        run_sequential(reg, dt);
+        return;
+    }
+
+    for (const auto& stage : schedule) {
+        _thread_pool->parallel_for(stage.size(), [&](size_t i) { run_system(stage[i], reg, dt); });
+        flush_stage(stage, reg);
     }
 }
 
@@ -24,4 +37,65 @@ void SystemManager::shutdown_all(registry& reg) {
     }
 }
 
+const std::vector<std::vector<size_t>>& SystemManager::stages(registry& reg) {
+    if (_schedule_dirty) {
+        build_schedule(reg);
+    }
+    return _stages;
+}
+
+void SystemManager::build_schedule(registry& reg) {
+    _accesses.clear();
+    _accesses.reserve(_systems.size());
+    for (auto& system : _systems) {
+        _accesses.push_back(system->access());
+        _accesses.back().register_pools(reg);
+    }
+
+    // Longest-path level in the conflict DAG (edges go from earlier to later systems).
+    std::vector<size_t> levels(_systems.size(), 0);
+    size_t stage_count = 0;
+    for (size_t j = 0; j < _systems.size(); ++j) {
+        for (size_t i = 0; i < j; ++i) {
+            if (_accesses[i].conflicts_with(_accesses[j])) {
+                levels[j] = std::max(levels[j], levels[i] + 1);
+            }
+        }
+        stage_count = std::max(stage_count, levels[j] + 1);
+    }
+
+    _stages.assign(stage_count, {});
+    for (size_t idx = 0; idx < _systems.size(); ++idx) {
+        _stages[levels[idx]].push_back(idx);
+        _profiler.set_stage(idx, levels[idx]);
+    }
+    _schedule_dirty = false;
+}
+
+void SystemManager::run_sequential(registry& reg, float dt) {
+    for (size_t idx = 0; idx < _systems.size(); ++idx) {
+        run_system(idx, reg, dt);
+        _sequential_stage[0] = idx;
+        flush_stage(_sequential_stage, reg);
+    }
+}
+
+void SystemManager::run_system(size_t idx, registry& reg, float dt) {
+    size_t entities = _accesses[idx].entities_touched(reg);
+    size_t allocations_before = SystemProfiler::thread_allocations();
+    auto start = SystemProfiler::clock::now();
+    _systems[idx]->update_deferred(reg, dt, _commands[idx]);
+    auto end = SystemProfiler::clock::now();
+    _profiler.record(idx, start, end, entities,
+                     SystemProfiler::thread_allocations() - allocations_before);
+}
+
+void SystemManager::flush_stage(const std::vector<size_t>& stage, registry& reg) {
+    auto start = SystemProfiler::clock::now();
+    for (size_t idx : stage) {
+        _commands[idx].flush(reg);
+    }
+    _profiler.end_stage(stage, start, SystemProfiler::clock::now());
+}
+
 }  // namespace engine
@@ -1,8 +1,12 @@
 #pragma once
 
+#include "CommandBuffer.hpp"
 #include "ISystem.hpp"
+#include "SystemProfiler.hpp"
+#include "ThreadPool.hpp"
 
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace engine {
@@ -14,6 +18,16 @@ namespace engine {
  * - Allowing systems to be registered in explicit order
  * - Providing lifecycle hooks (init, update, shutdown)
  * - Decoupling game logic from the main loop
+ *
+ * With a thread pool attached, systems are grouped into stages: a system
+ * lands one stage after the latest earlier-registered system whose
+ * SystemAccess conflicts with its own, so overlapping systems keep their
+ * registration order while independent ones share a stage and run in
+ * parallel. Each system records into its own CommandBuffer; buffers are
+ * flushed in registration order at the end of every stage.
+ *
+ * Every update and every stage flush is timed into a SystemProfiler; see
+ * stats() and write_chrome_trace().
  */
 class SystemManager {
 public:
@@ -34,7 +48,16 @@ public:
     void init_all(registry& reg);
 
     /**
-     * @brief Update all registered systems in order.
+     * @brief Run systems on @p pool (nullptr: sequential, the default).
+     * The pool is not owned and must outlive this manager.
+     */
+    void set_thread_pool(ThreadPool* pool) { _thread_pool = pool; }
+
+    /**
+     * @brief Update all registered systems.
+     * Each system runs through ISystem::update_deferred. Sequentially, the
+     * commands it records are flushed before the next system starts; with a
+     * thread pool, at the end of its stage.
      * @param reg Reference to the ECS registry.
      * @param dt Delta time since last update (seconds).
      */
@@ -51,8 +74,37 @@ public:
      */
     size_t count() const { return _systems.size(); }
 
+    /**
+     * @brief Systems (by registration index) per stage, rebuilt after each registration.
+     */
+    const std::vector<std::vector<size_t>>& stages(registry& reg);
+
+    /**
+     * @brief Per-system timings (min/avg/p99 over the last SystemProfiler::window_size
+     * updates), entities touched and allocations made by the last update.
+     */
+    std::vector<SystemStats> stats() const { return _profiler.snapshot(); }
+
+    /**
+     * @brief Dump the most recent system updates and flushes as Chrome trace JSON.
+     * @return false if @p path could not be written.
+     */
+    bool write_chrome_trace(const std::string& path) const { return _profiler.write_chrome_trace(path); }
+
 private:
+    void build_schedule(registry& reg);
+    void run_sequential(registry& reg, float dt);
+    void run_system(size_t idx, registry& reg, float dt);
+    void flush_stage(const std::vector<size_t>& stage, registry& reg);
+
     std::vector<std::unique_ptr<ISystem>> _systems;
+    std::vector<CommandBuffer> _commands;
+    std::vector<SystemAccess> _accesses;
+    SystemProfiler _profiler;
+    std::vector<std::vector<size_t>> _stages;
+    std::vector<size_t> _sequential_stage = std::vector<size_t>(1);  // Reused by run_sequential
+    bool _schedule_dirty = true;
+    ThreadPool* _thread_pool = nullptr;
 };
 
 }  // namespace engine
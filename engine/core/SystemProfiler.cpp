@@ -0,0 +1,194 @@
+#include "SystemProfiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+namespace engine {
+
+namespace {
+
+thread_local std::size_t tls_allocations = 0;
+
+std::string json_escape(const std::string& text) {
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            escaped.push_back('\\');
+        }
+        escaped.push_back(c);
+    }
+    return escaped;
+}
+
+}  // namespace
+
+SystemProfiler::SystemProfiler() : _origin(clock::now()) {}
+
+void SystemProfiler::add_system(std::string name) {
+    _slots.emplace_back();
+    _slots.back().name = std::move(name);
+}
+
+void SystemProfiler::set_stage(std::size_t system, std::size_t stage) {
+    _slots[system].stage = stage;
+}
+
+void SystemProfiler::record(std::size_t system, clock::time_point start, clock::time_point end,
+                            std::size_t entities, std::size_t allocations) {
+    auto& slot = _slots[system];
+    slot.window_ms[slot.next] = std::chrono::duration<float, std::milli>(end - start).count();
+    slot.next = (slot.next + 1) % window_size;
+    slot.samples = std::min(slot.samples + 1, window_size);
+    slot.entities = entities;
+    slot.allocations = allocations;
+    slot.pending = TraceEvent{static_cast<std::uint32_t>(system), thread_slot(), to_us(start),
+                              to_us(end) - to_us(start)};
+    slot.has_pending = true;
+}
+
+void SystemProfiler::end_stage(const std::vector<std::size_t>& stage, clock::time_point flush_start,
+                               clock::time_point flush_end) {
+    for (std::size_t system : stage) {
+        auto& slot = _slots[system];
+        if (slot.has_pending) {
+            push_trace(slot.pending);
+            slot.has_pending = false;
+        }
+    }
+    push_trace(TraceEvent{flush_event, thread_slot(), to_us(flush_start),
+                          to_us(flush_end) - to_us(flush_start)});
+}
+
+std::vector<SystemStats> SystemProfiler::snapshot() const {
+    std::vector<SystemStats> stats;
+    stats.reserve(_slots.size());
+    std::vector<float> sorted;
+    for (const auto& slot : _slots) {
+        SystemStats entry;
+        entry.name = slot.name;
+        entry.stage = slot.stage;
+        entry.samples = slot.samples;
+        entry.entities = slot.entities;
+        entry.allocations = slot.allocations;
+        if (slot.samples > 0) {
+            sorted.assign(slot.window_ms.begin(), slot.window_ms.begin() + slot.samples);
+            double total = 0.0;
+            for (float ms : sorted) {
+                total += static_cast<double>(ms);
+            }
+            entry.avg_ms = total / static_cast<double>(sorted.size());
+            entry.min_ms = *std::min_element(sorted.begin(), sorted.end());
+            std::size_t rank = (sorted.size() * 99 + 99) / 100 - 1;
+            std::nth_element(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(rank),
+                             sorted.end());
+            entry.p99_ms = sorted[rank];
+            entry.last_ms = slot.window_ms[(slot.next + window_size - 1) % window_size];
+        }
+        stats.push_back(std::move(entry));
+    }
+    return stats;
+}
+
+bool SystemProfiler::write_chrome_trace(const std::string& path) const {
+    std::ofstream out(path, std::ios::trunc);
+    if (!out) {
+        return false;
+    }
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    for (const auto& event : _trace) {
+        const std::string name =
+            event.name == flush_event ? std::string("CommandBuffer::flush") : _slots[event.name].name;
+        out << (first ? "" : ",") << "\n{\"name\":\"" << json_escape(name)
+            << "\",\"cat\":\"" << (event.name == flush_event ? "sync" : "system")
+            << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.tid << ",\"ts\":" << event.ts_us
+            << ",\"dur\":" << event.dur_us << "}";
+        first = false;
+    }
+    out << "\n]}\n";
+    return static_cast<bool>(out);
+}
+
+std::size_t SystemProfiler::thread_allocations() noexcept {
+    return tls_allocations;
+}
+
+bool SystemProfiler::tracks_allocations() noexcept {
+#ifdef RTYPE_TRACK_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::string SystemProfiler::type_name(const std::type_info& type) {
+#if defined(__GNUG__)
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(type.name(), nullptr, nullptr, &status);
+    if (status == 0 && demangled != nullptr) {
+        std::string name(demangled);
+        std::free(demangled);
+        return name;
+    }
+#endif
+    return type.name();
+}
+
+std::uint32_t SystemProfiler::thread_slot() noexcept {
+    static std::atomic<std::uint32_t> next_slot{1};
+    thread_local std::uint32_t slot = next_slot.fetch_add(1, std::memory_order_relaxed);
+    return slot;
+}
+
+std::int64_t SystemProfiler::to_us(clock::time_point t) const {
+    return std::chrono::duration_cast<std::chrono::microseconds>(t - _origin).count();
+}
+
+void SystemProfiler::push_trace(TraceEvent event) {
+    if (_trace.size() == trace_capacity) {
+        _trace.pop_front();
+    }
+    _trace.push_back(event);
+}
+
+}  // namespace engine
+
+#ifdef RTYPE_TRACK_ALLOCATIONS
+// Counting replacements for the global allocation functions. The aligned and
+// nothrow forms are left alone; the game code does not use them on hot paths.
+void* operator new(std::size_t size) {
+    ++engine::tls_allocations;
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+    std::free(p);
+}
+#endif
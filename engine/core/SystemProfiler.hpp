@@ -0,0 +1,128 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+namespace engine {
+
+/**
+ * @brief Aggregated timings of one system over the profiler's sliding window.
+ */
+struct SystemStats {
+    std::string name;
+    std::size_t stage = 0;
+    std::size_t samples = 0;     ///< Updates in the window (at most SystemProfiler::window_size)
+    double min_ms = 0.0;
+    double avg_ms = 0.0;
+    double p99_ms = 0.0;
+    double last_ms = 0.0;
+    std::size_t entities = 0;    ///< Entities the last update could touch (see SystemAccess)
+    std::size_t allocations = 0; ///< Heap allocations made by the last update, on its own thread
+};
+
+/**
+ * @brief Per-system timing, entity and allocation counters kept by the SystemManager.
+ *
+ * Each system owns one slot; record() only writes to that slot, so systems of
+ * the same stage may record concurrently. end_stage() then moves the stage's
+ * samples into a bounded Chrome trace buffer and must run on the thread
+ * driving SystemManager::update_all.
+ *
+ * Allocation counts need the global operator new replacement compiled in with
+ * RTYPE_TRACK_ALLOCATIONS; without it they stay at 0 and
+ * tracks_allocations() returns false.
+ */
+class SystemProfiler {
+public:
+    using clock = std::chrono::steady_clock;
+
+    static constexpr std::size_t window_size = 600;      ///< 10 s at 60 ticks per second
+    static constexpr std::size_t trace_capacity = 16384; ///< Oldest trace events are dropped first
+
+    SystemProfiler();
+
+    /**
+     * @brief Add a slot for the next registered system.
+     */
+    void add_system(std::string name);
+
+    void set_stage(std::size_t system, std::size_t stage);
+
+    /**
+     * @brief Record one update of @p system. Safe to call concurrently for distinct systems.
+     */
+    void record(std::size_t system, clock::time_point start, clock::time_point end,
+                std::size_t entities, std::size_t allocations);
+
+    /**
+     * @brief Trace the command flush that closes a stage, and commit the
+     * stage's system samples to the trace buffer.
+     */
+    void end_stage(const std::vector<std::size_t>& stage, clock::time_point flush_start,
+                   clock::time_point flush_end);
+
+    /**
+     * @brief Current stats of every system; call between two updates.
+     */
+    std::vector<SystemStats> snapshot() const;
+
+    /**
+     * @brief Write the buffered events as Chrome trace JSON (chrome://tracing, Perfetto).
+     * @return false if @p path could not be written.
+     */
+    bool write_chrome_trace(const std::string& path) const;
+
+    /**
+     * @brief Heap allocations made so far by the calling thread.
+     */
+    static std::size_t thread_allocations() noexcept;
+
+    static bool tracks_allocations() noexcept;
+
+    /**
+     * @brief Readable (demangled where supported) name of @p type, e.g. "MovementSystem".
+     */
+    static std::string type_name(const std::type_info& type);
+
+    /**
+     * @brief Small, stable id of the calling thread, used as the trace "tid".
+     */
+    static std::uint32_t thread_slot() noexcept;
+
+private:
+    struct TraceEvent {
+        std::uint32_t name;  ///< Index into _slots, or flush_event
+        std::uint32_t tid;
+        std::int64_t ts_us;
+        std::int64_t dur_us;
+    };
+
+    struct Slot {
+        std::string name;
+        std::size_t stage = 0;
+        std::array<float, window_size> window_ms{};
+        std::size_t samples = 0;
+        std::size_t next = 0;
+        std::size_t entities = 0;
+        std::size_t allocations = 0;
+        TraceEvent pending{};
+        bool has_pending = false;
+    };
+
+    static constexpr std::uint32_t flush_event = static_cast<std::uint32_t>(-1);
+
+    std::int64_t to_us(clock::time_point t) const;
+    void push_trace(TraceEvent event);
+
+    clock::time_point _origin;
+    std::deque<Slot> _slots;  // deque: slots stay put while systems are added
+    std::deque<TraceEvent> _trace;
+};
+
+}  // namespace engine
@@ -0,0 +1,158 @@
+#include "ThreadPool.hpp"
+
+#include <exception>
+
+namespace engine {
+
+namespace {
+
+constexpr std::size_t no_worker = static_cast<std::size_t>(-1);
+
+thread_local const ThreadPool* tls_pool = nullptr;
+thread_local std::size_t tls_worker_index = no_worker;
+
+}  // namespace
+
+ThreadPool::ThreadPool(std::size_t worker_count) {
+    _queues.reserve(worker_count);
+    for (std::size_t i = 0; i < worker_count; ++i) {
+        _queues.push_back(std::make_unique<WorkerQueue>());
+    }
+    _workers.reserve(worker_count);
+    for (std::size_t i = 0; i < worker_count; ++i) {
+        _workers.emplace_back([this, i]() { worker_loop(i); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(_wake_mutex);
+        _stopping = true;
+    }
+    _wake.notify_all();
+    for (auto& worker : _workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+std::size_t ThreadPool::default_worker_count() {
+    std::size_t hardware = std::thread::hardware_concurrency();
+    return hardware > 1 ? hardware - 1 : 1;
+}
+
+ThreadPool& ThreadPool::shared() {
+    static ThreadPool pool;
+    return pool;
+}
+
+void ThreadPool::parallel_for(std::size_t count, const std::function<void(std::size_t)>& fn) {
+    if (count == 0) {
+        return;
+    }
+    if (count == 1 || _workers.empty()) {
+        for (std::size_t i = 0; i < count; ++i) {
+            fn(i);
+        }
+        return;
+    }
+
+    struct Batch {
+        std::atomic<std::size_t> remaining;
+        std::mutex error_mutex;
+        std::exception_ptr error;
+    };
+    auto batch = std::make_shared<Batch>();
+    batch->remaining.store(count, std::memory_order_relaxed);
+
+    // fn outlives every task: this call does not return before remaining hits 0.
+    auto run = [batch, &fn](std::size_t i) {
+        try {
+            fn(i);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(batch->error_mutex);
+            if (!batch->error) {
+                batch->error = std::current_exception();
+            }
+        }
+        batch->remaining.fetch_sub(1, std::memory_order_acq_rel);
+    };
+
+    for (std::size_t i = 1; i < count; ++i) {
+        push([run, i]() { run(i); });
+    }
+    run(0);
+
+    std::size_t own_queue = (tls_pool == this) ? tls_worker_index : 0;
+    while (batch->remaining.load(std::memory_order_acquire) != 0) {
+        Task task;
+        if (try_pop(own_queue, task)) {
+            task();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    if (batch->error) {
+        std::rethrow_exception(batch->error);
+    }
+}
+
+void ThreadPool::worker_loop(std::size_t index) {
+    tls_pool = this;
+    tls_worker_index = index;
+
+    while (true) {
+        Task task;
+        if (try_pop(index, task)) {
+            task();
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(_wake_mutex);
+        _wake.wait(lock, [this]() {
+            return _stopping || _pending.load(std::memory_order_acquire) > 0;
+        });
+        if (_stopping && _pending.load(std::memory_order_acquire) == 0) {
+            return;
+        }
+    }
+}
+
+void ThreadPool::push(Task task) {
+    std::size_t target = (tls_pool == this)
+                             ? tls_worker_index
+                             : _next_queue.fetch_add(1, std::memory_order_relaxed) % _queues.size();
+    {
+        std::lock_guard<std::mutex> lock(_queues[target]->mutex);
+        _queues[target]->tasks.push_back(std::move(task));
+    }
+    {
+        std::lock_guard<std::mutex> lock(_wake_mutex);
+        _pending.fetch_add(1, std::memory_order_release);
+    }
+    _wake.notify_one();
+}
+
+bool ThreadPool::try_pop(std::size_t index, Task& out) {
+    const std::size_t queue_count = _queues.size();
+    for (std::size_t k = 0; k < queue_count; ++k) {
+        auto& queue = *_queues[(index + k) % queue_count];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) {
+            continue;
+        }
+        if (k == 0) {
+            out = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        } else {
+            out = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+        _pending.fetch_sub(1, std::memory_order_acq_rel);
+        return true;
+    }
+    return false;
+}
+
+}  // namespace engine
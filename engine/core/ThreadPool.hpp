@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace engine {
+
+/**
+ * @brief Work-stealing thread pool used to run independent systems and chunks.
+ *
+ * Every worker owns a deque: it pops its own tasks from the back and steals
+ * from the front of the others' when idle. A thread waiting in parallel_for()
+ * helps by running queued tasks, so nested parallel_for calls cannot deadlock.
+ */
+class ThreadPool {
+public:
+    explicit ThreadPool(std::size_t worker_count = default_worker_count());
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief One worker per hardware thread, minus the caller's.
+     */
+    static std::size_t default_worker_count();
+
+    /**
+     * @brief Process-wide pool, created on first use.
+     */
+    static ThreadPool& shared();
+
+    std::size_t worker_count() const noexcept { return _workers.size(); }
+
+    /**
+     * @brief Run fn(i) for every i in [0, count), the calling thread included.
+     * Returns once all calls finished; rethrows the first exception raised.
+     */
+    void parallel_for(std::size_t count, const std::function<void(std::size_t)>& fn);
+
+private:
+    using Task = std::function<void()>;
+
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    void worker_loop(std::size_t index);
+    void push(Task task);
+    bool try_pop(std::size_t index, Task& out);
+
+    std::vector<std::unique_ptr<WorkerQueue>> _queues;
+    std::vector<std::thread> _workers;
+    std::mutex _wake_mutex;
+    std::condition_variable _wake;
+    std::atomic<std::size_t> _pending{0};
+    std::atomic<std::size_t> _next_queue{0};
+    bool _stopping = false;
+};
+
+}  // namespace engine
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <array>
+#include <bit>
+
+/**
+ * @brief Fixed-size bitset of component ids owned by one entity.
+ *
+ * Stored inline per entity slot so spawning/killing never touches the heap;
+ * for_each_set() walks set bits word by word with countr_zero.
+ */
+class component_signature {
+public:
+    static constexpr std::size_t word_bits = 64;
+    static constexpr std::size_t word_count = 2;
+    static constexpr std::size_t capacity = word_bits * word_count;
+
+    constexpr void set(std::size_t bit) noexcept {
+        _words[bit / word_bits] |= (std::uint64_t{1} << (bit % word_bits));
+    }
+
+    constexpr void reset(std::size_t bit) noexcept {
+        _words[bit / word_bits] &= ~(std::uint64_t{1} << (bit % word_bits));
+    }
+
+    constexpr void clear() noexcept { _words = {}; }
+
+    [[nodiscard]] constexpr bool test(std::size_t bit) const noexcept {
+        return (_words[bit / word_bits] >> (bit % word_bits)) & 1u;
+    }
+
+    [[nodiscard]] constexpr bool any() const noexcept {
+        for (auto word : _words) {
+            if (word != 0)
+                return true;
+        }
+        return false;
+    }
+
+    [[nodiscard]] constexpr bool contains(component_signature const& other) const noexcept {
+        for (std::size_t w = 0; w < word_count; ++w) {
+            if ((_words[w] & other._words[w]) != other._words[w])
+                return false;
+        }
+        return true;
+    }
+
+    [[nodiscard]] constexpr bool intersects(component_signature const& other) const noexcept {
+        for (std::size_t w = 0; w < word_count; ++w) {
+            if ((_words[w] & other._words[w]) != 0)
+                return true;
+        }
+        return false;
+    }
+
+    template <class Function>
+    constexpr void for_each_set(Function&& fn) const {
+        for (std::size_t w = 0; w < word_count; ++w) {
+            std::uint64_t word = _words[w];
+            while (word != 0) {
+                fn(w * word_bits + static_cast<std::size_t>(std::countr_zero(word)));
+                word &= word - 1;
+            }
+        }
+    }
+
+    constexpr bool operator==(component_signature const& other) const noexcept = default;
+
+private:
+    std::array<std::uint64_t, word_count> _words{};
+};
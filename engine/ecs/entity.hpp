@@ -1,20 +1,38 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 
 class registry;
 
+/**
+ * @brief Entity handle: 32-bit slot index plus the generation of that slot.
+ *
+ * The index addresses component pools (and is what id()/size_t conversion
+ * return); the generation is bumped every time the slot is freed, so a handle
+ * kept across ticks can be checked with registry::is_alive() in O(1).
+ */
 class entity {
     friend class registry;
 
 public:
-    constexpr explicit operator std::size_t() const noexcept { return _id; }
-    constexpr bool operator==(entity const& other) const noexcept { return _id == other._id; }
-    constexpr bool operator!=(entity const& other) const noexcept { return _id != other._id; }
-    constexpr bool operator<(entity const& other) const noexcept { return _id < other._id; }
-    constexpr std::size_t id() const noexcept { return _id; }
+    using index_type = std::uint32_t;
+    using generation_type = std::uint32_t;
+
+    constexpr explicit operator std::size_t() const noexcept { return _index; }
+    constexpr bool operator==(entity const& other) const noexcept {
+        return _index == other._index && _generation == other._generation;
+    }
+    constexpr bool operator!=(entity const& other) const noexcept { return !(*this == other); }
+    constexpr bool operator<(entity const& other) const noexcept {
+        return _index != other._index ? _index < other._index : _generation < other._generation;
+    }
+    constexpr std::size_t id() const noexcept { return _index; }
+    constexpr generation_type generation() const noexcept { return _generation; }
 
 private:
-    constexpr explicit entity(std::size_t id) noexcept : _id(id) {}
-    std::size_t _id;
+    constexpr explicit entity(std::size_t id, generation_type generation = 0) noexcept
+        : _index(static_cast<index_type>(id)), _generation(generation) {}
+    index_type _index;
+    generation_type _generation;
 };
@@ -2,75 +2,55 @@
 
 #include <cstddef>
 
+#include <iterator>
 #include <tuple>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace containers {
 
 template <class... Containers>
 class indexed_zipper;
 
+/**
+ * @brief zipper_iterator that also yields the entity index of each match.
+ */
 template <class... Containers>
 class indexed_zipper_iterator {
     template <class Container>
-    using iterator_t = decltype(std::declval<Container&>().begin());
-
-    template <class Container>
-    using it_reference_t = typename iterator_t<Container>::reference;
-
-    template <class T>
-    struct extract_value_type;
-
-    template <class T>
-    struct extract_value_type<std::optional<T>&> {
-        using type = T&;
-    };
-
-    template <class T>
-    struct extract_value_type<const std::optional<T>&> {
-        using type = const T&;
-    };
+    using component_t = std::remove_pointer_t<decltype(std::declval<Container&>().find(0))>;
 
 public:
-    using value_type =
-        std::tuple<std::size_t, typename extract_value_type<it_reference_t<Containers>>::type...>;
+    using value_type = std::tuple<std::size_t, component_t<Containers>&...>;
     using reference = value_type;
     using pointer = void;
-    using difference_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
     using iterator_category = std::input_iterator_tag;
-    using iterator_tuple = std::tuple<iterator_t<Containers>...>;
+    using container_tuple = std::tuple<Containers*...>;
+    using index_list = std::vector<std::size_t>;
 
     friend class indexed_zipper<Containers...>;
 
 private:
-    explicit indexed_zipper_iterator(iterator_tuple const& it_tuple, std::size_t max)
-        : _current(it_tuple), _max(max), _idx(0) {
-        if (_idx < _max && !all_set(_seq)) {
-            advance_to_next_valid();
-        }
+    explicit indexed_zipper_iterator(container_tuple const& containers, index_list const* driver,
+                                     std::size_t pos)
+        : _containers(containers), _driver(driver), _pos(pos) {
+        advance_to_next_valid();
     }
 
-    explicit indexed_zipper_iterator(iterator_tuple const& it_tuple, std::size_t max,
-                                     std::size_t idx)
-        : _current(it_tuple), _max(max), _idx(idx) {}
-
 public:
     indexed_zipper_iterator(indexed_zipper_iterator const& z) = default;
 
     indexed_zipper_iterator& operator++() {
-        if (_idx < _max) {
-            increment_iterators(_seq);
-            advance_to_next_valid();
-        }
+        ++_pos;
+        advance_to_next_valid();
         return *this;
     }
 
     indexed_zipper_iterator operator++(int) {
         indexed_zipper_iterator tmp = *this;
-        if (_idx < _max) {
-            increment_iterators(_seq);
-            advance_to_next_valid();
-        }
+        ++(*this);
         return tmp;
     }
 
@@ -79,7 +59,7 @@ public:
     value_type operator->() { return to_value(_seq); }
 
     friend bool operator==(indexed_zipper_iterator const& lhs, indexed_zipper_iterator const& rhs) {
-        return lhs._idx == rhs._idx;
+        return lhs._pos == rhs._pos;
     }
 
     friend bool operator!=(indexed_zipper_iterator const& lhs, indexed_zipper_iterator const& rhs) {
@@ -87,34 +67,28 @@ public:
     }
 
 private:
-    template <std::size_t... Is>
-    void increment_iterators(std::index_sequence<Is...>) {
-        (++std::get<Is>(_current), ...);
-        ++_idx;
-    }
-
     void advance_to_next_valid() {
-        while (_idx < _max && !all_set(_seq)) {
-            increment_iterators(_seq);
+        while (_pos < _driver->size() && !all_set(_seq)) {
+            ++_pos;
         }
     }
 
     template <std::size_t... Is>
-    bool all_set(std::index_sequence<Is...>) {
-        if (_idx >= _max)
-            return false;
-        return ((*std::get<Is>(_current)).has_value() && ...);
+    bool all_set(std::index_sequence<Is...>) const {
+        std::size_t idx = (*_driver)[_pos];
+        return (std::get<Is>(_containers)->contains(idx) && ...);
     }
 
     template <std::size_t... Is>
     value_type to_value(std::index_sequence<Is...>) {
-        return std::make_tuple(_idx, std::ref((*std::get<Is>(_current)).value())...);
+        std::size_t idx = (*_driver)[_pos];
+        return value_type(idx, *std::get<Is>(_containers)->find(idx)...);
     }
 
 private:
-    iterator_tuple _current;
-    std::size_t _max;
-    std::size_t _idx;
+    container_tuple _containers;
+    index_list const* _driver;
+    std::size_t _pos;
     static constexpr std::index_sequence_for<Containers...> _seq{};
 };
 
@@ -122,32 +96,29 @@ template <class... Containers>
 class indexed_zipper {
 public:
     using iterator = indexed_zipper_iterator<Containers...>;
-    using iterator_tuple = typename iterator::iterator_tuple;
+    using container_tuple = typename iterator::container_tuple;
+    using index_list = typename iterator::index_list;
 
     explicit indexed_zipper(Containers&... cs)
-        : _begin(std::make_tuple(cs.begin()...)),
-          _end(_compute_end(cs...)),
-          _size(_compute_size(cs...)) {}
+        : _containers(std::make_tuple(&cs...)), _driver(_compute_driver(cs...)) {}
 
-    iterator begin() { return iterator(_begin, _size); }
+    iterator begin() { return iterator(_containers, _driver, 0); }
 
-    iterator end() { return iterator(_end, _size, _size); }
+    iterator end() { return iterator(_containers, _driver, _driver->size()); }
 
 private:
-    static std::size_t _compute_size(Containers&... containers) {
-        std::size_t min_size = static_cast<std::size_t>(-1);
-        ((min_size = std::min(min_size, containers.size())), ...);
-        return min_size == static_cast<std::size_t>(-1) ? 0 : min_size;
-    }
-
-    static iterator_tuple _compute_end(Containers&... containers) {
-        return std::make_tuple(containers.end()...);
+    static index_list const* _compute_driver(Containers&... containers) {
+        index_list const* driver = nullptr;
+        ((driver = (driver == nullptr || containers.dense_size() < driver->size())
+                       ? &containers.dense_indices()
+                       : driver),
+         ...);
+        return driver;
     }
 
 private:
-    iterator_tuple _begin;
-    iterator_tuple _end;
-    std::size_t _size;
+    container_tuple _containers;
+    index_list const* _driver;
 };
 
 }  // namespace containers
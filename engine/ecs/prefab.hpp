@@ -0,0 +1,67 @@
+#pragma once
+
+#include "registry.hpp"
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Entity template: a fixed component set with default values, built
+ * once and stamped into a registry by instantiate().
+ *
+ * Every component is copied from the template, so an instantiation allocates
+ * only where a component's copy does: keep heap data (frame tables, texture
+ * paths) behind shared pointers in the template. reserve() grows the entity
+ * table and each pool of the set ahead of a burst, so up to that many
+ * instantiations then fill pre-reserved slots without reallocating.
+ */
+template <typename... Components>
+class prefab {
+public:
+    explicit prefab(Components... defaults) : _defaults(std::move(defaults)...) {}
+
+    void reserve(registry& reg, std::size_t count) const {
+        reg.reserve_entities(count);
+        (reserve_pool<Components>(reg, count), ...);
+    }
+
+    /**
+     * @brief Spawn an entity with every component of the set; an @p overrides
+     * value replaces the template's component of the same type.
+     */
+    template <typename... Overrides>
+    entity instantiate(registry& reg, Overrides const&... overrides) const {
+        static_assert((is_component<Overrides> && ...), "override is not a component of this prefab");
+        entity e = reg.spawn_entity();
+        (reg.add_component(e, pick<Components>(overrides...)), ...);
+        return e;
+    }
+
+    template <typename Component>
+    Component const& get() const noexcept {
+        return std::get<Component>(_defaults);
+    }
+
+private:
+    template <typename Component>
+    static constexpr bool is_component = (std::is_same_v<Component, Components> || ...);
+
+    template <typename Component>
+    static void reserve_pool(registry& reg, std::size_t count) {
+        auto& pool = reg.get_components<Component>();
+        pool.reserve(pool.dense_size() + count);
+    }
+
+    template <typename Component, typename... Overrides>
+    Component const& pick(Overrides const&... overrides) const noexcept {
+        if constexpr ((std::is_same_v<Component, Overrides> || ...)) {
+            return std::get<Component const&>(std::forward_as_tuple(overrides...));
+        } else {
+            return std::get<Component>(_defaults);
+        }
+    }
+
+    std::tuple<Components...> _defaults;
+};
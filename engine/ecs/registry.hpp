@@ -1,22 +1,44 @@
 #pragma once
 
+#include "component_signature.hpp"
 #include "entity.hpp"
 #include "sparse_array.hpp"
+#include "view.hpp"
 
-#include <any>
-
-#include <functional>
+#include <atomic>
 #include <memory>
-#include <queue>
 #include <stdexcept>
-#include <typeindex>
-#include <unordered_map>
-#include <unordered_set>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+namespace ecs_detail {
+
+inline std::size_t next_component_type_id() noexcept {
+    static std::atomic<std::size_t> counter{0};
+    return counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+}  // namespace ecs_detail
+
+/**
+ * @brief Process-wide id of @p Component, assigned on first use.
+ *
+ * Ids are dense and shared by every registry, so they index pool tables and
+ * component_signature bits directly.
+ */
+template <typename Component>
+std::size_t component_type_id() noexcept {
+    static const std::size_t id = ecs_detail::next_component_type_id();
+    return id;
+}
+
 class registry {
 public:
     using entity_t = entity;
+    using component_id = std::size_t;
+
+    static constexpr std::size_t max_component_types = component_signature::capacity;
 
 private:
     class component_array_base {
@@ -24,6 +46,7 @@ private:
         virtual ~component_array_base() noexcept = default;
         virtual void erase_entity(entity_t entity) = 0;
         virtual std::size_t size() const noexcept = 0;
+        virtual std::size_t dense_size() const noexcept = 0;
     };
 
     template <typename Component>
@@ -36,149 +59,284 @@ private:
         }
 
         std::size_t size() const noexcept override { return data.size(); }
+        std::size_t dense_size() const noexcept override { return data.dense_size(); }
     };
 
-    std::unordered_map<std::type_index, std::unique_ptr<component_array_base>> _components_arrays;
-    std::unordered_map<std::type_index, std::function<void(registry&, entity_t const&)>>
-        _erase_functions;
-    std::size_t _next_entity_id = 0;
-    std::queue<std::size_t> _dead_entities;
-    std::unordered_map<std::size_t, std::unordered_set<std::type_index>> _entity_components;
+    struct entity_slot {
+        entity::generation_type generation = 0;
+        entity::index_type next_free = null_index;
+        bool alive = false;
+        component_signature signature;
+    };
+
+    static constexpr entity::index_type null_index = static_cast<entity::index_type>(-1);
+
+    // Indexed by component_type_id<T>(); null for types this registry never used.
+    // kill_entity erases from the pool of each bit set in the entity signature.
+    std::vector<std::unique_ptr<component_array_base>> _pools;
+
+    // Freed slots form an intrusive FIFO list threaded through _entity_slots, so
+    // an index is reused as late as possible and reuse never allocates.
+    std::vector<entity_slot> _entity_slots;
+    entity::index_type _free_head = null_index;
+    entity::index_type _free_tail = null_index;
+    std::size_t _alive_count = 0;
+
+    // Heap-allocated so group views can keep pointing at a member list while more
+    // groups are created.
+    std::vector<std::unique_ptr<ecs_detail::group_storage>> _groups;
+
+    parallel_executor _executor;
 
 public:
     registry() = default;
 
     template <typename Component>
     sparse_array<Component>& register_component() {
-        std::type_index type_idx(typeid(Component));
-        auto it = _components_arrays.find(type_idx);
-        if (it != _components_arrays.end()) {
-            auto* wrapper = static_cast<component_array<Component>*>(it->second.get());
-            return wrapper->data;
+        component_id id = component_type_id<Component>();
+        if (id < _pools.size() && _pools[id]) {
+            return static_cast<component_array<Component>*>(_pools[id].get())->data;
         }
+        if (id >= max_component_types) {
+            throw std::runtime_error("Too many component types registered");
+        }
+        if (id >= _pools.size())
+            _pools.resize(id + 1);
         auto wrapper = std::make_unique<component_array<Component>>();
         auto& ref = wrapper->data;
-        _components_arrays[type_idx] = std::move(wrapper);
-        _erase_functions[type_idx] = [](registry& reg, entity_t const& entity) {
-            reg.get_components<Component>().erase(static_cast<std::size_t>(entity));
-        };
+        _pools[id] = std::move(wrapper);
         return ref;
     }
 
     template <typename Component>
     sparse_array<Component>& get_components() {
-        std::type_index type_idx(typeid(Component));
-        auto it = _components_arrays.find(type_idx);
-        if (it == _components_arrays.end()) {
-            return register_component<Component>();
+        component_id id = component_type_id<Component>();
+        if (id < _pools.size() && _pools[id]) {
+            return static_cast<component_array<Component>*>(_pools[id].get())->data;
         }
-        auto* wrapper = static_cast<component_array<Component>*>(it->second.get());
-        return wrapper->data;
+        return register_component<Component>();
     }
 
     template <typename Component>
     sparse_array<Component> const& get_components() const {
-        std::type_index type_idx(typeid(Component));
-        auto it = _components_arrays.find(type_idx);
-        if (it == _components_arrays.end()) {
+        component_id id = component_type_id<Component>();
+        if (id >= _pools.size() || !_pools[id]) {
             throw std::runtime_error("Component type not registered");
         }
-        auto* wrapper = static_cast<component_array<Component>*>(it->second.get());
-        return wrapper->data;
+        return static_cast<component_array<Component> const*>(_pools[id].get())->data;
     }
 
     entity_t spawn_entity() {
-        if (!_dead_entities.empty()) {
-            std::size_t reused_id = _dead_entities.front();
-            _dead_entities.pop();
-            return entity(reused_id);
+        if (_free_head != null_index) {
+            entity::index_type reused_id = _free_head;
+            auto& slot = _entity_slots[reused_id];
+            _free_head = slot.next_free;
+            if (_free_head == null_index)
+                _free_tail = null_index;
+            slot.next_free = null_index;
+            slot.alive = true;
+            ++_alive_count;
+            return entity(reused_id, slot.generation);
         }
-        return entity(_next_entity_id++);
+        _entity_slots.push_back(entity_slot{0, null_index, true, {}});
+        ++_alive_count;
+        return entity(_entity_slots.size() - 1, 0);
+    }
+
+    /**
+     * @brief Handle for the current occupant of slot @p idx.
+     */
+    entity_t entity_from_index(std::size_t idx) const noexcept {
+        if (idx < _entity_slots.size())
+            return entity(idx, _entity_slots[idx].generation);
+        return entity(idx, 0);
+    }
+
+    /**
+     * @brief O(1) check that @p e still refers to a live entity (not a recycled slot).
+     */
+    bool is_alive(entity_t const& e) const noexcept {
+        std::size_t idx = e.id();
+        return idx < _entity_slots.size() && _entity_slots[idx].alive &&
+               _entity_slots[idx].generation == e.generation();
+    }
+
+    std::size_t alive_count() const noexcept { return _alive_count; }
+
+    /**
+     * @brief Make room for @p count more live entities without reallocating the slot table.
+     */
+    void reserve_entities(std::size_t count) {
+        _entity_slots.reserve(_alive_count + count);
     }
 
-    constexpr entity_t entity_from_index(std::size_t idx) const noexcept { return entity(idx); }
+    /**
+     * @brief Number of components stored in the pool of type @p id (0 if unused).
+     */
+    std::size_t pool_size(component_id id) const noexcept {
+        return id < _pools.size() && _pools[id] ? _pools[id]->dense_size() : 0;
+    }
 
     void kill_entity(entity_t const& e) {
-        std::size_t entity_id = e.id();
+        if (!is_alive(e))
+            return;
 
-        auto it = _entity_components.find(entity_id);
-        if (it != _entity_components.end()) {
-            for (const auto& type_idx : it->second) {
-                auto erase_it = _erase_functions.find(type_idx);
-                if (erase_it != _erase_functions.end()) {
-                    erase_it->second(*this, e);
-                }
-            }
-            _entity_components.erase(it);
+        std::size_t entity_id = e.id();
+        auto& signature = _entity_slots[entity_id].signature;
+        signature.for_each_set([this, e](component_id id) { _pools[id]->erase_entity(e); });
+        signature.clear();
+        refresh_groups(entity_id);
+
+        auto& slot = _entity_slots[entity_id];
+        slot.alive = false;
+        ++slot.generation;
+        --_alive_count;
+        auto freed = static_cast<entity::index_type>(entity_id);
+        if (_free_tail == null_index) {
+            _free_head = freed;
+        } else {
+            _entity_slots[_free_tail].next_free = freed;
         }
-
-        _dead_entities.push(entity_id);
+        _free_tail = freed;
     }
 
+    /**
+     * @brief Attach @p component to @p entity, replacing any existing one.
+     * Returns an empty reference (and stores nothing) if @p entity is stale.
+     */
     template <typename Component>
-    typename sparse_array<std::remove_reference_t<Component>>::reference_type
+    typename sparse_array<std::remove_cvref_t<Component>>::reference_type
     add_component(entity_t entity, Component&& component) {
-        using ComponentType = std::remove_reference_t<Component>;
-        std::type_index type_idx(typeid(ComponentType));
-
-        _entity_components[entity.id()].insert(type_idx);
-
-        return get_components<ComponentType>().insert_at(static_cast<std::size_t>(entity),
-                                                         std::forward<Component>(component));
+        using ComponentType = std::remove_cvref_t<Component>;
+        if (!is_alive(entity))
+            return {};
+        auto& ref = get_components<ComponentType>().insert_at(static_cast<std::size_t>(entity),
+                                                              std::forward<Component>(component));
+        mark_component(entity, component_type_id<ComponentType>());
+        return std::addressof(ref);
     }
 
     template <typename Component, typename... Params>
     typename sparse_array<Component>::reference_type emplace_component(entity_t entity,
                                                                        Params&&... params) {
-        std::type_index type_idx(typeid(Component));
-
-        _entity_components[entity.id()].insert(type_idx);
-
-        return get_components<Component>().emplace_at(static_cast<std::size_t>(entity),
-                                                      std::forward<Params>(params)...);
+        if (!is_alive(entity))
+            return {};
+        auto& ref = get_components<Component>().emplace_at(static_cast<std::size_t>(entity),
+                                                           std::forward<Params>(params)...);
+        mark_component(entity, component_type_id<Component>());
+        return std::addressof(ref);
     }
 
     template <typename Component>
     void remove_component(entity_t entity) {
-        std::type_index type_idx(typeid(Component));
-
-        auto it = _entity_components.find(entity.id());
-        if (it != _entity_components.end()) {
-            it->second.erase(type_idx);
-            if (it->second.empty()) {
-                _entity_components.erase(it);
-            }
-        }
+        if (!is_alive(entity))
+            return;
+
+        _entity_slots[entity.id()].signature.reset(component_type_id<Component>());
+        refresh_groups(entity.id());
 
         get_components<Component>().erase(static_cast<std::size_t>(entity));
     }
 
     template <typename Component>
     bool has_component(entity_t entity) const {
-        auto it = _entity_components.find(entity.id());
-        if (it == _entity_components.end())
+        if (!is_alive(entity))
             return false;
-
-        std::type_index type_idx(typeid(Component));
-        return it->second.find(type_idx) != it->second.end();
+        component_id id = component_type_id<Component>();
+        return id < component_signature::capacity && _entity_slots[entity.id()].signature.test(id);
     }
 
+    /**
+     * @brief Component of @p entity, or an empty ref if it has none or the handle is stale.
+     */
     template <typename Component>
     typename sparse_array<Component>::reference_type get_component(entity_t entity) {
+        if (!is_alive(entity))
+            return {};
         return get_components<Component>()[static_cast<std::size_t>(entity)];
     }
 
     template <typename Component>
     typename sparse_array<Component>::const_reference_type get_component(entity_t entity) const {
+        if (!is_alive(entity))
+            return {};
         return get_components<Component>()[static_cast<std::size_t>(entity)];
     }
+
+    /**
+     * @brief Entities owning every component in @p Components, driven by the smallest pool.
+     *
+     * Cheap to build; meant to be created on the fly each time a system runs.
+     */
+    template <typename... Components>
+    component_view<Components...> view() {
+        return component_view<Components...>(get_components<Components>()...);
+    }
+
+    /**
+     * @brief Persistent view whose matching entities are kept packed.
+     *
+     * The first call scans for matching entities; afterwards add/remove/kill
+     * update membership incrementally, so iteration never visits non-matching
+     * entities. Only changes made through the registry are tracked.
+     */
+    template <typename... Components>
+    component_view<Components...> group() {
+        component_signature mask;
+        (mask.set(component_type_id<Components>()), ...);
+        auto& storage = group_storage_for(mask);
+        return component_view<Components...>(storage.members, get_components<Components>()...);
+    }
+
+    /**
+     * @brief Executor used by parallel_each (empty: serial).
+     */
+    void set_parallel_executor(parallel_executor executor) { _executor = std::move(executor); }
+
+    /**
+     * @brief view<Components...>().parallel_each() on the registry's executor.
+     * See component_view::parallel_each for what @p fn may do.
+     */
+    template <typename... Components, typename Function>
+    void parallel_each(Function&& fn,
+                       std::size_t min_chunk = component_view<Components...>::default_min_chunk) {
+        view<Components...>().parallel_each(_executor, std::forward<Function>(fn), min_chunk);
+    }
+
+private:
+    void mark_component(entity_t entity, component_id id) {
+        _entity_slots[entity.id()].signature.set(id);
+        refresh_groups(entity.id());
+    }
+
+    void refresh_groups(std::size_t idx) {
+        for (auto& group : _groups) {
+            group->refresh(idx, _entity_slots[idx].signature);
+        }
+    }
+
+    ecs_detail::group_storage& group_storage_for(component_signature const& mask) {
+        for (auto& group : _groups) {
+            if (group->mask == mask)
+                return *group;
+        }
+        auto storage = std::make_unique<ecs_detail::group_storage>();
+        storage->mask = mask;
+        for (std::size_t idx = 0; idx < _entity_slots.size(); ++idx) {
+            if (_entity_slots[idx].alive)
+                storage->refresh(idx, _entity_slots[idx].signature);
+        }
+        _groups.push_back(std::move(storage));
+        return *_groups.back();
+    }
 };
 
 namespace std {
 template <>
 struct hash<entity> {
     std::size_t operator()(const entity& e) const {
-        return std::hash<std::size_t>{}(static_cast<std::size_t>(e));
+        return std::hash<std::uint64_t>{}((static_cast<std::uint64_t>(e.generation()) << 32) |
+                                          e.id());
     }
 };
 }  // namespace std
\ No newline at end of file
@@ -4,19 +4,70 @@
 
 #include <memory>
 #include <optional>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+/**
+ * @brief Nullable reference to a component stored in a sparse_array.
+ *
+ * Returned by sparse_array::operator[] so lookups keep the std::optional-like
+ * has_value()/value()/-> interface without storing an optional per component.
+ * Holds a pointer into the pool: invalidated like any other component reference.
+ */
+template <typename Component>
+class component_ref {
+public:
+    constexpr component_ref() noexcept = default;
+    constexpr component_ref(Component* component) noexcept : _component(component) {}
+
+    template <typename Other>
+        requires(!std::is_same_v<Other, Component> && std::is_convertible_v<Other*, Component*>)
+    constexpr component_ref(component_ref<Other> other) noexcept : _component(other.get()) {}
+
+    constexpr bool has_value() const noexcept { return _component != nullptr; }
+    constexpr explicit operator bool() const noexcept { return has_value(); }
+
+    constexpr Component* get() const noexcept { return _component; }
+    constexpr Component& operator*() const noexcept { return *_component; }
+    constexpr Component* operator->() const noexcept { return _component; }
+
+    Component& value() const {
+        if (_component == nullptr)
+            throw std::bad_optional_access();
+        return *_component;
+    }
+
+private:
+    Component* _component = nullptr;
+};
+
+/**
+ * @brief Sparse-set component storage indexed by entity id.
+ *
+ * Components live packed in a dense array alongside the entity index that owns
+ * them; a paged sparse table maps entity indices to dense slots. operator[]
+ * returns a nullable component_ref (empty for indices without a component, and
+ * never creates one), while begin()/end(), for_each() and the dense_* accessors
+ * walk only live components, in dense order.
+ *
+ * erase() swaps the last dense component into the freed slot, so references
+ * obtained from this pool are invalidated by any insert or erase.
+ */
 template <typename Component>
 class sparse_array {
 public:
-    using value_type = std::optional<Component>;
-    using reference_type = value_type&;
-    using const_reference_type = value_type const&;
-    using container_t = std::vector<value_type>;
+    using value_type = Component;
+    using reference_type = component_ref<Component>;
+    using const_reference_type = component_ref<Component const>;
+    using container_t = std::vector<Component>;
     using size_type = typename container_t::size_type;
     using iterator = typename container_t::iterator;
     using const_iterator = typename container_t::const_iterator;
 
+    static constexpr size_type npos = static_cast<size_type>(-1);
+    static constexpr size_type page_size = 4096;
+
 public:
     sparse_array() = default;
     sparse_array(sparse_array const&) = default;
@@ -25,77 +76,164 @@ public:
     sparse_array& operator=(sparse_array const&) = default;
     sparse_array& operator=(sparse_array&&) noexcept = default;
 
-    reference_type operator[](size_t idx) {
-        if (idx >= _data.size())
-            _data.resize(idx + 1);
-        return _data[idx];
+    reference_type operator[](size_type idx) noexcept { return reference_type(find(idx)); }
+
+    const_reference_type operator[](size_type idx) const noexcept {
+        return const_reference_type(find(idx));
+    }
+
+    iterator begin() noexcept { return _dense.begin(); }
+    const_iterator begin() const noexcept { return _dense.begin(); }
+    const_iterator cbegin() const noexcept { return _dense.cbegin(); }
+
+    iterator end() noexcept { return _dense.end(); }
+    const_iterator end() const noexcept { return _dense.end(); }
+    const_iterator cend() const noexcept { return _dense.cend(); }
+
+    /**
+     * @brief Index range covered by the pool (highest inserted index + 1).
+     */
+    size_type size() const noexcept { return _extent; }
+
+    bool contains(size_type pos) const noexcept { return dense_slot(pos) != npos; }
+
+    /**
+     * @brief Component stored at @p pos, or nullptr (single sparse lookup).
+     */
+    Component* find(size_type pos) noexcept {
+        size_type dense_idx = dense_slot(pos);
+        return dense_idx == npos ? nullptr : std::addressof(_dense[dense_idx]);
     }
 
-    const_reference_type operator[](size_t idx) const {
-        if (idx >= _data.size())
-            return _null_optional;
-        return _data[idx];
+    Component const* find(size_type pos) const noexcept {
+        size_type dense_idx = dense_slot(pos);
+        return dense_idx == npos ? nullptr : std::addressof(_dense[dense_idx]);
     }
 
-    iterator begin() noexcept { return _data.begin(); }
-    const_iterator begin() const noexcept { return _data.begin(); }
-    const_iterator cbegin() const noexcept { return _data.cbegin(); }
+    /**
+     * @brief Number of live components stored contiguously.
+     */
+    size_type dense_size() const noexcept { return _dense.size(); }
+
+    /**
+     * @brief Entity index owning the component at dense slot @p dense_idx.
+     */
+    size_type dense_index(size_type dense_idx) const noexcept { return _indices[dense_idx]; }
+
+    Component& dense_value(size_type dense_idx) noexcept { return _dense[dense_idx]; }
+    Component const& dense_value(size_type dense_idx) const noexcept { return _dense[dense_idx]; }
+
+    std::vector<size_type> const& dense_indices() const noexcept { return _indices; }
+
+    /**
+     * @brief Call fn(index, component) for every live component, in dense order.
+     * The callback must not insert into or erase from this pool.
+     */
+    template <class Function>
+    void for_each(Function&& fn) {
+        for (size_type d = 0; d < _dense.size(); ++d) {
+            fn(_indices[d], _dense[d]);
+        }
+    }
 
-    iterator end() noexcept { return _data.end(); }
-    const_iterator end() const noexcept { return _data.end(); }
-    const_iterator cend() const noexcept { return _data.cend(); }
+    template <class Function>
+    void for_each(Function&& fn) const {
+        for (size_type d = 0; d < _dense.size(); ++d) {
+            fn(_indices[d], _dense[d]);
+        }
+    }
 
-    size_type size() const noexcept { return _data.size(); }
+    void reserve(size_type count) {
+        _dense.reserve(count);
+        _indices.reserve(count);
+    }
 
-    reference_type insert_at(size_type pos, Component const& value) {
-        if (pos >= _data.size())
-            _data.resize(pos + 1);
-        _data[pos] = value;
-        return _data[pos];
+    Component& insert_at(size_type pos, Component const& value) {
+        size_type dense_idx = dense_slot(pos);
+        if (dense_idx != npos) {
+            _dense[dense_idx] = value;
+            return _dense[dense_idx];
+        }
+        return push_dense(pos, value);
     }
 
-    reference_type insert_at(size_type pos, Component&& value) {
-        if (pos >= _data.size())
-            _data.resize(pos + 1);
-        _data[pos] = std::move(value);
-        return _data[pos];
+    Component& insert_at(size_type pos, Component&& value) {
+        size_type dense_idx = dense_slot(pos);
+        if (dense_idx != npos) {
+            _dense[dense_idx] = std::move(value);
+            return _dense[dense_idx];
+        }
+        return push_dense(pos, std::move(value));
     }
 
     template <class... Params>
-    reference_type emplace_at(size_type pos, Params&&... params) {
-        if (pos >= _data.size())
-            _data.resize(pos + 1);
-
-        auto& slot = _data[pos];
-        if (slot.has_value()) {
-            using component_allocator = typename std::allocator_traits<
-                typename container_t::allocator_type>::template rebind_alloc<Component>;
-            using component_alloc_traits = std::allocator_traits<component_allocator>;
-            component_allocator alloc = _data.get_allocator();
-            component_alloc_traits::destroy(alloc, std::addressof(slot.value()));
-            component_alloc_traits::construct(alloc, std::addressof(slot.value()),
-                                              std::forward<Params>(params)...);
-        } else {
-            slot.emplace(std::forward<Params>(params)...);
+    Component& emplace_at(size_type pos, Params&&... params) {
+        size_type dense_idx = dense_slot(pos);
+        if (dense_idx != npos) {
+            _dense[dense_idx] = Component(std::forward<Params>(params)...);
+            return _dense[dense_idx];
         }
-        return slot;
+        return push_dense(pos, std::forward<Params>(params)...);
     }
 
     void erase(size_type pos) {
-        if (pos < _data.size())
-            _data[pos].reset();
+        size_type dense_idx = dense_slot(pos);
+        if (dense_idx == npos)
+            return;
+
+        size_type last = _dense.size() - 1;
+        if (dense_idx != last) {
+            _dense[dense_idx] = std::move(_dense[last]);
+            _indices[dense_idx] = _indices[last];
+            sparse_ref(_indices[dense_idx]) = dense_idx;
+        }
+        _dense.pop_back();
+        _indices.pop_back();
+        sparse_ref(pos) = npos;
     }
 
-    size_type get_index(value_type const& v) const noexcept {
-        const void* target_addr = std::addressof(v);
-        for (size_type i = 0; i < _data.size(); ++i) {
-            if (std::addressof(_data[i]) == target_addr)
-                return i;
-        }
-        return static_cast<size_type>(-1);
+    /**
+     * @brief Entity index owning @p v, or npos if @p v is not stored in this pool.
+     */
+    size_type get_index(Component const& v) const noexcept {
+        const Component* target_addr = std::addressof(v);
+        if (_dense.empty() || target_addr < _dense.data() ||
+            target_addr >= _dense.data() + _dense.size())
+            return npos;
+        return _indices[static_cast<size_type>(target_addr - _dense.data())];
+    }
+
+private:
+    size_type dense_slot(size_type pos) const noexcept {
+        size_type page = pos / page_size;
+        if (page >= _sparse.size() || _sparse[page].empty())
+            return npos;
+        return _sparse[page][pos % page_size];
+    }
+
+    size_type& sparse_ref(size_type pos) {
+        size_type page = pos / page_size;
+        if (page >= _sparse.size())
+            _sparse.resize(page + 1);
+        if (_sparse[page].empty())
+            _sparse[page].assign(page_size, npos);
+        return _sparse[page][pos % page_size];
+    }
+
+    template <class... Params>
+    Component& push_dense(size_type pos, Params&&... params) {
+        size_type& slot = sparse_ref(pos);
+        _dense.emplace_back(std::forward<Params>(params)...);
+        _indices.push_back(pos);
+        slot = _dense.size() - 1;
+        if (pos >= _extent)
+            _extent = pos + 1;
+        return _dense.back();
     }
 
 private:
-    container_t _data;
-    static inline const value_type _null_optional = std::nullopt;
-};
\ No newline at end of file
+    std::vector<std::vector<size_type>> _sparse;
+    container_t _dense;
+    std::vector<size_type> _indices;
+    size_type _extent = 0;
+};
@@ -0,0 +1,240 @@
+#pragma once
+
+#include "component_signature.hpp"
+#include "sparse_array.hpp"
+
+#include <cassert>
+#include <cstddef>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+class registry;
+
+namespace ecs_detail {
+
+/**
+ * @brief Packed list of the entity indices whose signature contains @p mask.
+ *
+ * Owned by the registry, which calls refresh() whenever an entity's signature
+ * changes, so membership is maintained incrementally instead of rescanned.
+ */
+struct group_storage {
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    component_signature mask;
+    std::vector<std::size_t> members;
+    std::vector<std::size_t> slots;
+
+    void refresh(std::size_t idx, component_signature const& signature) {
+        bool match = signature.contains(mask);
+        bool member = idx < slots.size() && slots[idx] != npos;
+        if (match && !member) {
+            if (idx >= slots.size())
+                slots.resize(idx + 1, npos);
+            slots[idx] = members.size();
+            members.push_back(idx);
+        } else if (!match && member) {
+            std::size_t pos = slots[idx];
+            members[pos] = members.back();
+            slots[members[pos]] = pos;
+            members.pop_back();
+            slots[idx] = npos;
+        }
+    }
+};
+
+}  // namespace ecs_detail
+
+/**
+ * @brief Runs fn(i) for every i in [0, count) and returns once all calls are done.
+ * Empty means serial; the engine installs one backed by its thread pool.
+ */
+using parallel_executor =
+    std::function<void(std::size_t, std::function<void(std::size_t)> const&)>;
+
+/**
+ * @brief Query over the entities owning every component in @p Components.
+ *
+ * A plain view (registry::view) is driven by the smallest pool, chosen when the
+ * view is built, and probes the other pools through their sparse tables to skip
+ * entities missing a component. A group view (registry::group) is driven by the
+ * group's packed member list, which the registry keeps exact, so it skips that
+ * membership probe; each visited entity still costs one sparse lookup per pool
+ * to resolve its components.
+ *
+ * Entities are visited back to front, so spawning, or killing (or removing
+ * components from) the entity being visited, is safe while iterating; new
+ * entities are not visited. Any other structural change (removing components
+ * from other entities, or editing pools behind the registry's back) can skip or
+ * revisit entities, and trips an assert when a group member lost a component:
+ * defer such changes through engine::CommandBuffer.
+ * Component references handed out are invalidated by inserts into their pool:
+ * copy anything that must outlive a spawn.
+ */
+template <class... Components>
+class component_view {
+    static_assert(sizeof...(Components) > 0, "component_view needs at least one component");
+
+public:
+    using value_type = std::tuple<std::size_t, Components&...>;
+
+    // Chunks span a multiple of 64 dense slots, so neighbouring chunks share at
+    // most one cache line of any pool whatever the component size.
+    static constexpr std::size_t chunk_alignment = 64;
+    static constexpr std::size_t default_min_chunk = 256;
+
+    class iterator {
+    public:
+        using value_type = component_view::value_type;
+        using reference = value_type;
+        using pointer = void;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::input_iterator_tag;
+
+        iterator() = default;
+        iterator(component_view const* view, std::size_t remaining)
+            : _view(view), _remaining(remaining) {
+            skip_unmatched();
+        }
+
+        reference operator*() const { return _view->fetch((*_view->_driver)[_remaining - 1]); }
+
+        iterator& operator++() {
+            --_remaining;
+            skip_unmatched();
+            return *this;
+        }
+
+        iterator operator++(int) {
+            iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        friend bool operator==(iterator const& lhs, iterator const& rhs) {
+            return lhs._remaining == rhs._remaining;
+        }
+
+        friend bool operator!=(iterator const& lhs, iterator const& rhs) { return !(lhs == rhs); }
+
+    private:
+        void skip_unmatched() {
+            while (_remaining > 0) {
+                // The loop body may have erased several entities since the last step.
+                if (_remaining > _view->_driver->size()) {
+                    _remaining = _view->_driver->size();
+                    continue;
+                }
+                if (_view->matches((*_view->_driver)[_remaining - 1]))
+                    return;
+                --_remaining;
+            }
+        }
+
+        component_view const* _view = nullptr;
+        std::size_t _remaining = 0;
+    };
+
+    explicit component_view(sparse_array<Components>&... pools) : _pools(&pools...) {
+        auto consider = [this](auto const& pool) {
+            if (_driver == nullptr || pool.dense_size() < _driver->size())
+                _driver = &pool.dense_indices();
+        };
+        (consider(pools), ...);
+    }
+
+    iterator begin() const { return iterator(this, _driver->size()); }
+    iterator end() const { return iterator(this, 0); }
+
+    /**
+     * @brief Call fn(index, components...) for every matching entity.
+     */
+    template <class Function>
+    void each(Function&& fn) const {
+        std::size_t remaining = _driver->size();
+        while (remaining > 0) {
+            if (remaining > _driver->size()) {
+                remaining = _driver->size();
+                continue;
+            }
+            visit((*_driver)[--remaining], fn);
+        }
+    }
+
+    /**
+     * @brief each(), split into contiguous chunks of the driving pool run on @p executor.
+     *
+     * Stays serial without an executor or below two chunks' worth of entities.
+     * @p fn runs concurrently: it may only touch the components it is handed
+     * and must not spawn, kill or add/remove components.
+     */
+    template <class Function>
+    void parallel_each(parallel_executor const& executor, Function&& fn,
+                       std::size_t min_chunk = default_min_chunk) const {
+        const std::size_t total = _driver->size();
+        const std::size_t chunk =
+            std::max<std::size_t>(chunk_alignment,
+                                  (min_chunk + chunk_alignment - 1) / chunk_alignment *
+                                      chunk_alignment);
+        if (!executor || total < 2 * chunk) {
+            each(fn);
+            return;
+        }
+        const std::size_t chunk_count = (total + chunk - 1) / chunk;
+        executor(chunk_count, [this, &fn, chunk, total](std::size_t c) {
+            const std::size_t last = std::min(total, (c + 1) * chunk);
+            for (std::size_t d = c * chunk; d < last; ++d) {
+                visit((*_driver)[d], fn);
+            }
+        });
+    }
+
+    /**
+     * @brief Upper bound on the number of entities visited.
+     */
+    std::size_t size_hint() const noexcept { return _driver->size(); }
+
+private:
+    friend class registry;
+
+    component_view(std::vector<std::size_t> const& members, sparse_array<Components>&... pools)
+        : _pools(&pools...), _driver(&members), _probe(false) {}
+
+    template <class Function>
+    void visit(std::size_t idx, Function& fn) const {
+        auto found =
+            std::apply([idx](auto*... pools) { return std::tuple(pools->find(idx)...); }, _pools);
+        bool complete = std::apply([](auto*... ptrs) { return ((ptrs != nullptr) && ...); }, found);
+        if (complete) {
+            std::apply([&fn, idx](auto*... ptrs) { fn(idx, *ptrs...); }, found);
+        }
+    }
+
+    bool matches(std::size_t idx) const {
+        return !_probe || std::apply([idx](auto*... pools) { return (pools->contains(idx) && ...); },
+                                     _pools);
+    }
+
+    value_type fetch(std::size_t idx) const {
+        return std::apply(
+            [idx](auto*... pools) { return value_type(idx, resolved(pools->find(idx))...); },
+            _pools);
+    }
+
+    template <class Component>
+    static Component& resolved(Component* component) noexcept {
+        // Group members are trusted without probing; a miss means a pool changed
+        // mid-iteration without going through the registry (see class comment).
+        assert(component != nullptr && "component_view: structural change during iteration");
+        return *component;
+    }
+
+    std::tuple<sparse_array<Components>*...> _pools;
+    std::vector<std::size_t> const* _driver = nullptr;
+    bool _probe = true;
+};
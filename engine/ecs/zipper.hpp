@@ -4,7 +4,6 @@
 
 #include <cstddef>
 
-#include <algorithm>
 #include <tuple>
 
 namespace containers {
@@ -13,32 +12,29 @@ template <class... Containers>
 class zipper {
 public:
     using iterator = zipper_iterator<Containers...>;
-    using iterator_tuple = typename iterator::iterator_tuple;
+    using container_tuple = typename iterator::container_tuple;
+    using index_list = typename iterator::index_list;
 
     explicit zipper(Containers&... cs)
-        : _begin(std::make_tuple(cs.begin()...)),
-          _end(_compute_end(cs...)),
-          _size(_compute_size(cs...)) {}
+        : _containers(std::make_tuple(&cs...)), _driver(_compute_driver(cs...)) {}
 
-    iterator begin() { return iterator(_begin, _size); }
+    iterator begin() { return iterator(_containers, _driver, 0); }
 
-    iterator end() { return iterator(_end, _size, _size); }
+    iterator end() { return iterator(_containers, _driver, _driver->size()); }
 
 private:
-    static std::size_t _compute_size(Containers&... containers) {
-        std::size_t min_size = static_cast<std::size_t>(-1);
-        ((min_size = std::min(min_size, containers.size())), ...);
-        return min_size == static_cast<std::size_t>(-1) ? 0 : min_size;
-    }
-
-    static iterator_tuple _compute_end(Containers&... containers) {
-        return std::make_tuple(containers.end()...);
+    static index_list const* _compute_driver(Containers&... containers) {
+        index_list const* driver = nullptr;
+        ((driver = (driver == nullptr || containers.dense_size() < driver->size())
+                       ? &containers.dense_indices()
+                       : driver),
+         ...);
+        return driver;
     }
 
 private:
-    iterator_tuple _begin;
-    iterator_tuple _end;
-    std::size_t _size;
+    container_tuple _containers;
+    index_list const* _driver;
 };
 
 }  // namespace containers
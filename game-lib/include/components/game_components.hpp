@@ -3,14 +3,23 @@
 #include "logic_components.hpp"
 
 #include <SFML/Graphics.hpp>
+#include <memory>
+#include <span>
 #include <string>
+#include <string_view>
 #include <cstdint>
 #include <vector>
 #include "../../../engine/ecs/components.hpp"
 
 
+/**
+ * @brief Sprite state mirrored to clients.
+ *
+ * The texture path is immutable and shared, so copying a sprite (prefab
+ * templates do it on every spawn) only bumps a reference count.
+ */
 struct sprite_component {
-    std::string texture_path;
+    std::shared_ptr<const std::string> texture_path;
     int texture_rect_x;
     int texture_rect_y;
     int texture_rect_w;
@@ -26,22 +35,49 @@ struct sprite_component {
     sprite_component(std::string path = "", int rect_x = 0, int rect_y = 0, int rect_w = 32,
                      int rect_h = 16, float sprite_scale = 2.0f, bool flip_h = false, bool is_visible = true,
                      bool is_grayscale = false)
-        : texture_path(std::move(path)),
+        : sprite_component(path.empty() ? nullptr : std::make_shared<const std::string>(std::move(path)),
+                           rect_x, rect_y, rect_w, rect_h, sprite_scale, flip_h) {
+        visible = is_visible;
+        grayscale = is_grayscale;
+    }
+
+    sprite_component(std::shared_ptr<const std::string> shared_path, int rect_x, int rect_y, int rect_w,
+                     int rect_h, float sprite_scale = 2.0f, bool flip_h = false)
+        : texture_path(std::move(shared_path)),
           texture_rect_x(rect_x),
           texture_rect_y(rect_y),
           texture_rect_w(rect_w),
           texture_rect_h(rect_h),
           scale(sprite_scale),
           flip_horizontal(flip_h),
-          visible(is_visible),
-          grayscale(is_grayscale),
+          visible(true),
+          grayscale(false),
           mirror_x(flip_h),
           mirror_y(false),
           rotation(0.0f) {}
+
+    [[nodiscard]] const std::string& texture() const noexcept {
+        static const std::string none;
+        return texture_path ? *texture_path : none;
+    }
+
+    void set_texture(std::string path) {
+        texture_path = std::make_shared<const std::string>(std::move(path));
+    }
 };
 
+/**
+ * @brief Immutable frame list shared by every animation built from the same template.
+ */
+using frame_table = std::shared_ptr<const std::vector<sf::IntRect>>;
+
+inline frame_table make_frame_table(std::vector<sf::IntRect> frames) {
+    return std::make_shared<const std::vector<sf::IntRect>>(std::move(frames));
+}
+
 struct animation_component {
     std::vector<sf::IntRect> frames;
+    frame_table shared_frames;
     size_t current_frame;
     float frame_duration;
     float time_accumulator;
@@ -55,25 +91,42 @@ struct animation_component {
           time_accumulator(0.0f),
           loop(should_loop) {}
 
+    animation_component(frame_table table, float duration, bool should_loop = true)
+        : shared_frames(std::move(table)),
+          current_frame(0),
+          frame_duration(duration),
+          time_accumulator(0.0f),
+          loop(should_loop) {}
+
+    /**
+     * @brief The shared table when there is one, otherwise the owned frames.
+     */
+    [[nodiscard]] std::span<const sf::IntRect> frame_list() const noexcept {
+        if (shared_frames) return *shared_frames;
+        return frames;
+    }
+
     void update(float dt) {
-        if (frames.empty()) return;
+        auto table = frame_list();
+        if (table.empty()) return;
 
         time_accumulator += dt;
         if (time_accumulator >= frame_duration) {
             time_accumulator -= frame_duration;
             current_frame++;
 
-            if (current_frame >= frames.size()) {
-                current_frame = loop ? 0 : frames.size() - 1;
+            if (current_frame >= table.size()) {
+                current_frame = loop ? 0 : table.size() - 1;
             }
         }
     }
 
     [[nodiscard]] sf::IntRect get_current_frame() const {
-        if (frames.empty()) {
+        auto table = frame_list();
+        if (table.empty()) {
             return sf::IntRect{0, 0, 32, 16};
         }
-        return frames[current_frame];
+        return table[current_frame];
     }
 };
 
@@ -144,7 +197,26 @@ struct laser_damage_immunity {
 };
 
 struct custom_attack_config {
-    std::string pattern_type = "front";
+    enum class pattern : std::uint8_t {
+        front,     ///< One shot straight ahead
+        targeted,  ///< One shot at the nearest player, within a forward cone
+        spread,    ///< projectile_count shots fanned over spread_angle degrees
+    };
+
+    /**
+     * @brief Pattern for a level's attack type; unknown types shoot straight ahead.
+     */
+    static pattern parse_pattern(std::string_view type) noexcept {
+        if (type == "targeted") {
+            return pattern::targeted;
+        }
+        if (type == "spread") {
+            return pattern::spread;
+        }
+        return pattern::front;
+    }
+
+    pattern pattern_type = pattern::front;
     int projectile_count = 1;
     float spread_angle = 30.0f;
     bool aim_at_player = false;
@@ -160,11 +232,21 @@ struct custom_attack_config {
     float projectile_rotation = 0.0f;
 };
 
+/**
+ * @brief Level-defined id sent to clients; shared so prefab copies do not allocate.
+ */
 struct custom_entity_id {
-    std::string entity_id;
-    
+    std::shared_ptr<const std::string> entity_id;
+
     custom_entity_id() = default;
-    explicit custom_entity_id(std::string id) : entity_id(std::move(id)) {}
+    explicit custom_entity_id(std::string id)
+        : entity_id(std::make_shared<const std::string>(std::move(id))) {}
+    explicit custom_entity_id(std::shared_ptr<const std::string> id) : entity_id(std::move(id)) {}
+
+    [[nodiscard]] const std::string& id() const noexcept {
+        static const std::string none;
+        return entity_id ? *entity_id : none;
+    }
 };
 
 struct explosive_projectile {
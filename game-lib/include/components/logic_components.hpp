@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cmath>
+#include <cstdint>
 #include "../../../src/Common/Opcodes.hpp"
 #include "../../../engine/ecs/entity.hpp"
 #include "../powerup/PowerupRegistry.hpp"
@@ -162,6 +163,39 @@ struct bounded_movement {
         : min_x(minx), max_x(maxx), min_y(miny), max_y(maxy) {}
 };
 
+/**
+ * @brief Scripted vertical motion: each tick the movement system sets vy from
+ * the pattern, then moves the entity by its velocity like any other.
+ *
+ * t is the session's movement clock (movement_state), so entities sharing a
+ * pattern stay in step within a lobby and never across lobbies.
+ */
+struct movement_pattern {
+    enum class kind : std::uint8_t {
+        sine,    ///< vy = amplitude * sin(frequency * t + phase + phase_per_x * x)
+        zigzag,  ///< vy = +amplitude, then -amplitude, for one unit of frequency * t + phase each
+    };
+    static constexpr std::size_t kind_count = 2;
+
+    kind type;
+    float amplitude;    ///< Peak vertical speed
+    float frequency;
+    float phase;
+    float phase_per_x;  ///< Sine only: phase per unit of the x the entity moves to
+
+    constexpr movement_pattern(kind t_type = kind::sine, float amp = 0.0f, float freq = 0.0f,
+                               float ph = 0.0f, float per_x = 0.0f) noexcept
+        : type(t_type), amplitude(amp), frequency(freq), phase(ph), phase_per_x(per_x) {}
+
+    static constexpr movement_pattern sine(float amp, float freq, float ph = 0.0f,
+                                           float per_x = 0.0f) noexcept {
+        return {kind::sine, amp, freq, ph, per_x};
+    }
+    static constexpr movement_pattern zigzag(float amp, float freq, float ph = 0.0f) noexcept {
+        return {kind::zigzag, amp, freq, ph};
+    }
+};
+
 struct wave_manager {
     float timer = 0.0f;
     float spawn_interval = 5.0f;
@@ -457,6 +491,62 @@ struct entity_tag {
     constexpr explicit entity_tag(RType::EntityType t_type) noexcept : type(t_type) {}
 };
 
+/**
+ * @brief Collision filtering bits: what an entity is (category) and which
+ * categories it tests against when it drives a collision pass (mask).
+ *
+ * Pairs are only tested from the driving side, so targets such as enemies and
+ * players keep an empty mask. Entities spawned without this component get one
+ * inferred from their tags by the collision system.
+ */
+struct collision_layer {
+    enum bits : std::uint16_t {
+        Player           = 1 << 0,
+        PlayerProjectile = 1 << 1,
+        AllyProjectile   = 1 << 2,  ///< Drone shots, never subject to friendly fire
+        EnemyProjectile  = 1 << 3,
+        BossProjectile   = 1 << 4,  ///< Enemy shots player projectiles cannot cancel
+        Enemy            = 1 << 5,
+        Boss             = 1 << 6,
+        SerpentPart      = 1 << 7,
+        Homing           = 1 << 8,
+    };
+    static constexpr std::size_t category_count = 9;
+
+    static constexpr std::uint16_t player_shots = PlayerProjectile | AllyProjectile;
+    static constexpr std::uint16_t enemy_shots = EnemyProjectile | BossProjectile;
+    static constexpr std::uint16_t shootable = Enemy | Boss | SerpentPart | Homing;
+
+    std::uint16_t category;
+    std::uint16_t mask;
+
+    constexpr collision_layer(std::uint16_t cat = 0, std::uint16_t msk = 0) noexcept
+        : category(cat), mask(msk) {}
+
+    [[nodiscard]] constexpr bool is(std::uint16_t categories) const noexcept {
+        return (category & categories) != 0;
+    }
+    [[nodiscard]] constexpr bool tests(std::uint16_t categories) const noexcept {
+        return (mask & categories) != 0;
+    }
+
+    static constexpr collision_layer player() noexcept { return {Player}; }
+    static constexpr collision_layer player_projectile() noexcept {
+        return {PlayerProjectile, shootable | EnemyProjectile};
+    }
+    static constexpr collision_layer ally_projectile() noexcept {
+        return {AllyProjectile, shootable | EnemyProjectile};
+    }
+    static constexpr collision_layer enemy_projectile() noexcept {
+        return {EnemyProjectile, Player | player_shots};
+    }
+    static constexpr collision_layer boss_projectile() noexcept { return {BossProjectile, Player}; }
+    static constexpr collision_layer enemy() noexcept { return {Enemy}; }
+    static constexpr collision_layer boss() noexcept { return {Boss}; }
+    static constexpr collision_layer serpent() noexcept { return {SerpentPart, Player}; }
+    static constexpr collision_layer homing() noexcept { return {Homing, Player}; }
+};
+
 struct network_id {
     int client_id;
     constexpr explicit network_id(int c_id = -1) noexcept : client_id(c_id) {}
@@ -473,6 +563,21 @@ enum class SerpentPartType : uint8_t {
     Tail = 4
 };
 
+/**
+ * @brief Pins an entity's position to its parent's position plus a fixed offset.
+ *
+ * Resolved by transform_hierarchy, parents before children, so chains of links
+ * settle in one sweep. A child whose parent died stays where it was last put.
+ */
+struct transform_link {
+    entity parent;
+    float offset_x;
+    float offset_y;
+
+    constexpr explicit transform_link(entity parent_entity, float dx = 0.0f, float dy = 0.0f) noexcept
+        : parent(parent_entity), offset_x(dx), offset_y(dy) {}
+};
+
 struct serpent_part {
     SerpentPartType part_type;
     int part_index;
@@ -610,6 +715,8 @@ struct compiler_boss_controller {
     std::optional<entity> part1_entity;
     std::optional<entity> part2_entity;
     std::optional<entity> part3_entity;
+    // Point the assembled parts are linked to (transform_link).
+    std::optional<entity> formation_anchor;
 
     float part1_target_x = 0.0f, part1_target_y = 0.0f;
     float part2_target_x = 0.0f, part2_target_y = 0.0f;
@@ -1,6 +1,19 @@
 #pragma once
 
+#include "core/CommandBuffer.hpp"
 #include "ecs/registry.hpp"
 #include "ecs/entity.hpp"
 
+#include <cstddef>
+
 entity createExplosion(registry& reg, float x, float y);
+
+/**
+ * @brief Deferred variant: the explosion is spawned when @p commands is flushed.
+ */
+void createExplosion(engine::CommandBuffer& commands, float x, float y);
+
+/**
+ * @brief Grow the explosion pools so the next @p count explosions spawn without reallocating.
+ */
+void reserveExplosions(registry& reg, std::size_t count);
@@ -27,3 +27,8 @@ entity createEnemy5Projectile(registry& reg, float x, float y, float vx, float v
 entity createExplosiveGrenade(registry& reg, float x, float y, float vx, float vy,
                               float lifetime = 2.0f, float explosion_radius = 80.0f,
                               int explosion_damage = 40);
+
+/**
+ * @brief Grow the enemy projectile pools so the next @p count enemy shots spawn without reallocating.
+ */
+void reserveEnemyProjectiles(registry& reg, std::size_t count);
@@ -0,0 +1,279 @@
+#pragma once
+
+#include "components/logic_components.hpp"
+#include "ecs/components.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define RTYPE_AABB_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+// MSVC accepts any intrinsic without per-function targets; GCC and Clang need
+// the attribute to emit AVX2 code in a translation unit built for baseline x86.
+#if defined(__GNUC__) || defined(__clang__)
+#define RTYPE_TARGET(isa) __attribute__((target(isa)))
+#else
+#define RTYPE_TARGET(isa)
+#endif
+
+/**
+ * @brief World-space axis-aligned box (left/top inclusive, right/bottom exclusive).
+ */
+struct aabb {
+    float left;
+    float top;
+    float right;
+    float bottom;
+
+    [[nodiscard]] constexpr bool overlaps(aabb const& other) const noexcept {
+        return left < other.right && right > other.left && top < other.bottom && bottom > other.top;
+    }
+
+    /**
+     * @brief Bounds of this box over a tick that moved it by (@p dx, @p dy) to where it is now.
+     */
+    [[nodiscard]] constexpr aabb swept(float dx, float dy) const noexcept {
+        return aabb{std::min(left, left - dx), std::min(top, top - dy), std::max(right, right - dx),
+                    std::max(bottom, bottom - dy)};
+    }
+
+    /**
+     * @brief Earliest time of the tick, in [0, 1], at which this box overlaps
+     * the still box @p other, or a negative value if it never does.
+     *
+     * This box is where it ends the tick, having moved by (@p dx, @p dy); pass
+     * the difference of both displacements when @p other moves too. With no
+     * motion this is 0 exactly when overlaps() is true.
+     */
+    [[nodiscard]] float sweep_time(float dx, float dy, aabb const& other) const noexcept {
+        float entry = -std::numeric_limits<float>::infinity();
+        float exit = std::numeric_limits<float>::infinity();
+        auto axis = [&](float lo, float hi, float other_lo, float other_hi, float d) {
+            if (d == 0.0f) {
+                return lo < other_hi && hi > other_lo;
+            }
+            // At time t the box spans [lo + (t - 1) * d, hi + (t - 1) * d].
+            float enter_at = 1.0f + (d > 0.0f ? other_lo - hi : other_hi - lo) / d;
+            float leave_at = 1.0f + (d > 0.0f ? other_hi - lo : other_lo - hi) / d;
+            entry = std::max(entry, enter_at);
+            exit = std::min(exit, leave_at);
+            return true;
+        };
+        if (!axis(left, right, other.left, other.right, dx) || !axis(top, bottom, other.top, other.bottom, dy)) {
+            return -1.0f;
+        }
+        if (!(entry < exit && entry < 1.0f && exit > 0.0f)) {
+            return -1.0f;
+        }
+        return std::max(entry, 0.0f);
+    }
+
+    [[nodiscard]] static constexpr aabb from(position const& pos, collision_box const& box) noexcept {
+        float l = pos.x + box.offset_x;
+        float t = pos.y + box.offset_y;
+        return aabb{l, t, l + box.width, t + box.height};
+    }
+
+    [[nodiscard]] static constexpr aabb from(position const& pos,
+                                             multi_hitbox::hitbox_part const& part) noexcept {
+        float l = pos.x + part.offset_x;
+        float t = pos.y + part.offset_y;
+        return aabb{l, t, l + part.width, t + part.height};
+    }
+
+    /**
+     * @brief Bounds of every part of @p hitbox, or an empty box if it has none.
+     */
+    [[nodiscard]] static aabb bounds(position const& pos, multi_hitbox const& hitbox) noexcept {
+        if (hitbox.parts.empty()) {
+            return aabb{pos.x, pos.y, pos.x, pos.y};
+        }
+        aabb result = from(pos, hitbox.parts.front());
+        for (auto const& part : hitbox.parts) {
+            aabb box = from(pos, part);
+            result.left = std::min(result.left, box.left);
+            result.top = std::min(result.top, box.top);
+            result.right = std::max(result.right, box.right);
+            result.bottom = std::max(result.bottom, box.bottom);
+        }
+        return result;
+    }
+};
+
+/**
+ * @brief Structure-of-arrays snapshot of many boxes, laid out for the batch kernels.
+ */
+struct aabb_soa {
+    std::vector<float> left;
+    std::vector<float> top;
+    std::vector<float> right;
+    std::vector<float> bottom;
+
+    void clear() {
+        left.clear();
+        top.clear();
+        right.clear();
+        bottom.clear();
+    }
+
+    void resize(std::size_t count) {
+        left.resize(count);
+        top.resize(count);
+        right.resize(count);
+        bottom.resize(count);
+    }
+
+    void set(std::size_t i, aabb const& box) {
+        left[i] = box.left;
+        top[i] = box.top;
+        right[i] = box.right;
+        bottom[i] = box.bottom;
+    }
+
+    std::size_t size() const noexcept { return left.size(); }
+};
+
+/**
+ * @brief Batched overlap tests of one probe box against a run of SoA boxes.
+ *
+ * Every kernel writes the index of each box in [begin, end) overlapping the
+ * probe to @p out, in ascending order, and returns how many it wrote; @p out
+ * must have room for end - begin entries. The SSE kernel tests 4 boxes per
+ * step and the AVX2 one 8; all of them agree exactly with aabb::overlaps,
+ * NaN coordinates included. active() picks the widest one the CPU supports.
+ */
+namespace aabb_batch {
+
+enum class isa : std::uint8_t { scalar, sse, avx2 };
+
+using kernel = std::uint32_t (*)(aabb_soa const& boxes, std::uint32_t begin, std::uint32_t end,
+                                 aabb const& probe, std::uint32_t* out);
+
+inline std::uint32_t overlap_scalar(aabb_soa const& boxes, std::uint32_t begin, std::uint32_t end,
+                                    aabb const& probe, std::uint32_t* out) {
+    std::uint32_t hits = 0;
+    for (std::uint32_t i = begin; i < end; ++i) {
+        if (boxes.left[i] < probe.right && boxes.right[i] > probe.left && boxes.top[i] < probe.bottom &&
+            boxes.bottom[i] > probe.top) {
+            out[hits++] = i;
+        }
+    }
+    return hits;
+}
+
+#ifdef RTYPE_AABB_X86
+
+inline void emit_hits(unsigned bits, std::uint32_t first, std::uint32_t* out, std::uint32_t& hits) {
+    while (bits != 0) {
+        out[hits++] = first + static_cast<std::uint32_t>(std::countr_zero(bits));
+        bits &= bits - 1;
+    }
+}
+
+RTYPE_TARGET("sse2")
+inline std::uint32_t overlap_sse(aabb_soa const& boxes, std::uint32_t begin, std::uint32_t end,
+                                 aabb const& probe, std::uint32_t* out) {
+    const __m128 probe_left = _mm_set1_ps(probe.left);
+    const __m128 probe_top = _mm_set1_ps(probe.top);
+    const __m128 probe_right = _mm_set1_ps(probe.right);
+    const __m128 probe_bottom = _mm_set1_ps(probe.bottom);
+
+    std::uint32_t hits = 0;
+    std::uint32_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        __m128 x = _mm_and_ps(_mm_cmplt_ps(_mm_loadu_ps(&boxes.left[i]), probe_right),
+                              _mm_cmpgt_ps(_mm_loadu_ps(&boxes.right[i]), probe_left));
+        __m128 y = _mm_and_ps(_mm_cmplt_ps(_mm_loadu_ps(&boxes.top[i]), probe_bottom),
+                              _mm_cmpgt_ps(_mm_loadu_ps(&boxes.bottom[i]), probe_top));
+        emit_hits(static_cast<unsigned>(_mm_movemask_ps(_mm_and_ps(x, y))), i, out, hits);
+    }
+    return hits + overlap_scalar(boxes, i, end, probe, out + hits);
+}
+
+RTYPE_TARGET("avx2")
+inline std::uint32_t overlap_avx2(aabb_soa const& boxes, std::uint32_t begin, std::uint32_t end,
+                                  aabb const& probe, std::uint32_t* out) {
+    const __m256 probe_left = _mm256_set1_ps(probe.left);
+    const __m256 probe_top = _mm256_set1_ps(probe.top);
+    const __m256 probe_right = _mm256_set1_ps(probe.right);
+    const __m256 probe_bottom = _mm256_set1_ps(probe.bottom);
+
+    std::uint32_t hits = 0;
+    std::uint32_t i = begin;
+    for (; i + 8 <= end; i += 8) {
+        __m256 x = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(&boxes.left[i]), probe_right, _CMP_LT_OQ),
+                                 _mm256_cmp_ps(_mm256_loadu_ps(&boxes.right[i]), probe_left, _CMP_GT_OQ));
+        __m256 y = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(&boxes.top[i]), probe_bottom, _CMP_LT_OQ),
+                                 _mm256_cmp_ps(_mm256_loadu_ps(&boxes.bottom[i]), probe_top, _CMP_GT_OQ));
+        emit_hits(static_cast<unsigned>(_mm256_movemask_ps(_mm256_and_ps(x, y))), i, out, hits);
+    }
+    return hits + overlap_sse(boxes, i, end, probe, out + hits);
+}
+
+#endif  // RTYPE_AABB_X86
+
+/**
+ * @brief Widest instruction set the running CPU supports.
+ */
+inline isa detect() noexcept {
+#if defined(RTYPE_AABB_X86) && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return isa::avx2;
+    }
+    return __builtin_cpu_supports("sse2") ? isa::sse : isa::scalar;
+#elif defined(RTYPE_AABB_X86) && defined(_MSC_VER)
+    int regs[4] = {};
+    __cpuid(regs, 0);
+    if (regs[0] >= 7) {
+        __cpuid(regs, 1);
+        const bool os_saves_ymm = (regs[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+        __cpuidex(regs, 7, 0);
+        if (os_saves_ymm && (regs[1] & (1 << 5)) != 0) {
+            return isa::avx2;
+        }
+    }
+    return isa::sse;
+#else
+    return isa::scalar;
+#endif
+}
+
+/**
+ * @brief Kernel for @p set, falling back to the next narrower one this build has.
+ */
+inline kernel select(isa set) noexcept {
+#ifdef RTYPE_AABB_X86
+    switch (set) {
+    case isa::avx2:
+        return overlap_avx2;
+    case isa::sse:
+        return overlap_sse;
+    case isa::scalar:
+        break;
+    }
+#else
+    (void)set;
+#endif
+    return overlap_scalar;
+}
+
+/**
+ * @brief Kernel for the running CPU, resolved once.
+ */
+inline kernel active() noexcept {
+    static const kernel selected = select(detect());
+    return selected;
+}
+
+}  // namespace aabb_batch
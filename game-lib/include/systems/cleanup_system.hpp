@@ -1,5 +1,13 @@
 #pragma once
 
+#include "core/CommandBuffer.hpp"
 #include "ecs/registry.hpp"
 
+/**
+ * @brief Kill what the damage paths flagged as dead, the entities whose
+ * despawn_schedule lifetime ran out and the shots/enemies the movement stage
+ * flagged as off the playfield.
+ * Kills and death explosions are recorded into @p commands.
+ */
+void cleanupSystem(registry& reg, float dt, engine::CommandBuffer& commands);
 void cleanupSystem(registry& reg, float dt);
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief One contact found by collision detection, or a death it caused.
+ *
+ * Detection only reads components and appends these; the resolution stages
+ * (damage, explosions, scoring, kills) then apply them in order. Indices are
+ * entity slots of the tick the events were produced in.
+ */
+struct collision_event {
+    enum class kind : std::uint8_t {
+        shot_hit,         ///< A player shot (source) hit an enemy, boss, serpent part or homing missile
+        shots_cancelled,  ///< A player shot (source) and an enemy shot (target) met
+        player_hit,       ///< An enemy shot, homing missile, serpent part or friendly shot hit a player
+        shield_hit,       ///< A player's (source) shield reached an enemy or boss
+        killed,           ///< Target's health dropped to zero; emitted by the damage stage
+    };
+
+    enum flag : std::uint8_t {
+        source_consumed = 1 << 0,  ///< The source is destroyed by this contact
+        shielded        = 1 << 1,  ///< The player's shield absorbed the damage
+        laser           = 1 << 2,  ///< Grants the player laser immunity
+    };
+
+    kind type;
+    kind cause;                     ///< For killed: the kind of contact that dealt the last blow
+    std::uint8_t flags;
+    std::uint16_t target_category;  ///< collision_layer category bit the target was hit as
+    std::uint32_t source;
+    std::uint32_t target;
+    std::int32_t amount;            ///< Damage dealt
+
+    [[nodiscard]] constexpr bool has(flag f) const noexcept { return (flags & f) != 0; }
+};
+
+using collision_event_buffer = std::vector<collision_event>;
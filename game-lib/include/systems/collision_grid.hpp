@@ -0,0 +1,212 @@
+#pragma once
+
+#include "systems/aabb_batch.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Uniform-grid broadphase over the playfield, rebuilt every tick.
+ *
+ * Boxes are bucketed into every cell they cover; anything outside the
+ * playfield is clamped into the border cells, so off-screen entities are still
+ * found, just less selectively. Cells are stored as one flat array (counting
+ * sort), so a rebuild allocates nothing once the grid has warmed up. Each
+ * cell's boxes are also copied into an SoA snapshot in the same order, which
+ * queries scan with the widest aabb_batch kernel the CPU supports.
+ *
+ * Usage per tick:
+ *   grid.clear();
+ *   grid.insert(idx, box);   // for every collidable entity
+ *   grid.build();
+ *   grid.query(box, [&](std::size_t idx) { ... });  // narrowphase on candidates
+ */
+class collision_grid {
+public:
+    static constexpr float playfield_width = 1920.0f;
+    static constexpr float playfield_height = 1080.0f;
+    static constexpr float default_cell_size = 128.0f;
+
+    explicit collision_grid(float cell_size = default_cell_size,
+                            float width = playfield_width, float height = playfield_height)
+        : _inv_cell_size(1.0f / cell_size),
+          _columns(std::max(1, static_cast<int>(width / cell_size + 0.999f))),
+          _rows(std::max(1, static_cast<int>(height / cell_size + 0.999f))),
+          _kernel(aabb_batch::active()) {}
+
+    /**
+     * @brief Override the overlap kernel, e.g. to compare instruction sets.
+     */
+    void use_kernel(aabb_batch::kernel kernel) noexcept { _kernel = kernel; }
+
+    void clear() {
+        _entries.clear();
+        _boxes.clear();
+        _built = false;
+    }
+
+    void insert(std::size_t idx, aabb const& box) {
+        _entries.push_back(idx);
+        _boxes.push_back(box);
+        _built = false;
+    }
+
+    /**
+     * @brief Bucket the inserted boxes into cells; required before query().
+     */
+    void build() {
+        const std::size_t cell_count =
+            static_cast<std::size_t>(_columns) * static_cast<std::size_t>(_rows);
+        _cell_start.assign(cell_count + 1, 0);
+        for (auto const& box : _boxes) {
+            for_each_cell(box, [&](std::size_t cell) { ++_cell_start[cell + 1]; });
+        }
+        for (std::size_t c = 0; c < cell_count; ++c) {
+            _cell_start[c + 1] += _cell_start[c];
+        }
+        _cell_items.resize(_cell_start[cell_count]);
+        _cell_boxes.resize(_cell_start[cell_count]);
+        _fill.assign(_cell_start.begin(), _cell_start.end() - 1);
+        for (std::uint32_t entry = 0; entry < _boxes.size(); ++entry) {
+            for_each_cell(_boxes[entry], [&](std::size_t cell) {
+                _cell_boxes.set(_fill[cell], _boxes[entry]);
+                _cell_items[_fill[cell]++] = entry;
+            });
+        }
+        std::uint32_t widest = 0;
+        for (std::size_t c = 0; c < cell_count; ++c) {
+            widest = std::max(widest, _cell_start[c + 1] - _cell_start[c]);
+        }
+        _hits.resize(widest);
+        _stamps.assign(_boxes.size(), 0);
+        _query_stamp = 0;
+        _built = true;
+    }
+
+    /**
+     * @brief Call @p visit(idx) once for every inserted entity whose box overlaps @p box.
+     */
+    template <typename Visitor>
+    void query(aabb const& box, Visitor&& visit) const {
+        if (!_built) {
+            return;
+        }
+        if (++_query_stamp == 0) {
+            std::fill(_stamps.begin(), _stamps.end(), 0);
+            _query_stamp = 1;
+        }
+        for_each_cell(box, [&](std::size_t cell) {
+            const std::uint32_t hits =
+                _kernel(_cell_boxes, _cell_start[cell], _cell_start[cell + 1], box, _hits.data());
+            for (std::uint32_t h = 0; h < hits; ++h) {
+                std::uint32_t entry = _cell_items[_hits[h]];
+                if (_stamps[entry] == _query_stamp) {
+                    continue;
+                }
+                _stamps[entry] = _query_stamp;
+                visit(_entries[entry]);
+            }
+        });
+    }
+
+    /**
+     * @brief Lowest entity index overlapping @p box and accepted by @p filter, or npos.
+     * Matches what an ascending scan with an early break would pick.
+     */
+    template <typename Filter>
+    std::size_t first_hit(aabb const& box, Filter&& filter) const {
+        std::size_t best = npos;
+        query(box, [&](std::size_t idx) {
+            if (idx < best && filter(idx)) {
+                best = idx;
+            }
+        });
+        return best;
+    }
+
+    /**
+     * @brief Entity with the earliest contact time among those overlapping
+     * @p bounds, or npos; ties go to the lowest index.
+     *
+     * @p impact(idx) returns the contact time in [0, 1] (see aabb::sweep_time)
+     * or a negative value to reject the candidate. With every time at 0 this
+     * picks the same entity as first_hit().
+     */
+    template <typename Impact>
+    std::size_t earliest_hit(aabb const& bounds, Impact&& impact) const {
+        std::size_t best = npos;
+        float best_time = 0.0f;
+        earliest_hit(bounds, impact, best, best_time);
+        return best;
+    }
+
+    /**
+     * @brief earliest_hit() continuing from a previous best, to search several grids.
+     */
+    template <typename Impact>
+    void earliest_hit(aabb const& bounds, Impact&& impact, std::size_t& best, float& best_time) const {
+        query(bounds, [&](std::size_t idx) {
+            if (best != npos && best_time == 0.0f && idx > best) {
+                return;  // Cannot beat a lower index hit at time 0
+            }
+            float t = impact(idx);
+            if (t < 0.0f) {
+                return;
+            }
+            if (best == npos || t < best_time || (t == best_time && idx < best)) {
+                best = idx;
+                best_time = t;
+            }
+        });
+    }
+
+    std::size_t size() const noexcept { return _entries.size(); }
+    int columns() const noexcept { return _columns; }
+    int rows() const noexcept { return _rows; }
+
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+private:
+    int cell_coord(float v, int count) const noexcept {
+        float scaled = v * _inv_cell_size;
+        if (!(scaled > 0.0f)) {  // negative or NaN
+            return 0;
+        }
+        if (scaled >= static_cast<float>(count)) {
+            return count - 1;
+        }
+        return static_cast<int>(scaled);
+    }
+
+    template <typename Function>
+    void for_each_cell(aabb const& box, Function&& fn) const {
+        int c0 = cell_coord(box.left, _columns);
+        int c1 = cell_coord(box.right, _columns);
+        int r0 = cell_coord(box.top, _rows);
+        int r1 = cell_coord(box.bottom, _rows);
+        for (int r = r0; r <= r1; ++r) {
+            for (int c = c0; c <= c1; ++c) {
+                fn(static_cast<std::size_t>(r) * static_cast<std::size_t>(_columns) +
+                   static_cast<std::size_t>(c));
+            }
+        }
+    }
+
+    float _inv_cell_size;
+    int _columns;
+    int _rows;
+
+    std::vector<std::size_t> _entries;
+    std::vector<aabb> _boxes;
+    std::vector<std::uint32_t> _cell_start;
+    std::vector<std::uint32_t> _cell_items;
+    std::vector<std::uint32_t> _fill;
+    aabb_soa _cell_boxes;
+    aabb_batch::kernel _kernel;
+    mutable std::vector<std::uint32_t> _hits;  // Kernel output for the cell being scanned
+    mutable std::vector<std::uint32_t> _stamps;
+    mutable std::uint32_t _query_stamp = 0;
+    bool _built = false;
+};
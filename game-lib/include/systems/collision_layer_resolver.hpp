@@ -0,0 +1,83 @@
+#pragma once
+
+#include "components/game_components.hpp"
+#include "components/logic_components.hpp"
+#include "ecs/registry.hpp"
+
+#include <cstddef>
+
+/**
+ * @brief Looks up the collision_layer of an entity, or infers it from its tags.
+ *
+ * The factories in game-lib/src/entities attach a collision_layer; entities
+ * spawned elsewhere (boss parts, level configs, custom waves) only carry tags,
+ * so this is the one place mapping those tags to categories. Entities without
+ * any collidable tag resolve to an empty layer and are ignored by the
+ * collision system.
+ */
+class collision_layer_resolver {
+public:
+    explicit collision_layer_resolver(registry& reg)
+        : _layers(reg.get_components<collision_layer>()),
+          _players(reg.get_components<player_tag>()),
+          _enemies(reg.get_components<enemy_tag>()),
+          _bosses(reg.get_components<boss_tag>()),
+          _projectiles(reg.get_components<projectile_tag>()),
+          _ally_projectiles(reg.get_components<ally_projectile_tag>()),
+          _entity_tags(reg.get_components<entity_tag>()),
+          _serpent_parts(reg.get_components<serpent_part>()),
+          _homings(reg.get_components<homing_component>()) {}
+
+    [[nodiscard]] collision_layer operator()(std::size_t idx) const {
+        if (const collision_layer* layer = _layers.find(idx)) {
+            return *layer;
+        }
+        return infer(idx);
+    }
+
+    [[nodiscard]] collision_layer infer(std::size_t idx) const {
+        if (_projectiles.contains(idx)) {
+            if (!_enemies.contains(idx)) {
+                return _ally_projectiles.contains(idx) ? collision_layer::ally_projectile()
+                                                       : collision_layer::player_projectile();
+            }
+            // Boss shots are tagged with the Enemy3 entity type.
+            const entity_tag* tag = _entity_tags.find(idx);
+            return tag != nullptr && tag->type == RType::EntityType::Enemy3
+                       ? collision_layer::boss_projectile()
+                       : collision_layer::enemy_projectile();
+        }
+
+        collision_layer layer;
+        if (_players.contains(idx)) {
+            layer.category |= collision_layer::Player;
+        }
+        if (_serpent_parts.contains(idx)) {
+            // Serpent parts also carry enemy_tag but are only hurt through their controller.
+            layer.category |= collision_layer::SerpentPart;
+        } else if (_enemies.contains(idx)) {
+            layer.category |= collision_layer::Enemy;
+        }
+        if (_bosses.contains(idx)) {
+            layer.category |= collision_layer::Boss;
+        }
+        if (_homings.contains(idx)) {
+            layer.category |= collision_layer::Homing;
+        }
+        if (layer.is(collision_layer::SerpentPart | collision_layer::Homing)) {
+            layer.mask = collision_layer::Player;
+        }
+        return layer;
+    }
+
+private:
+    sparse_array<collision_layer>& _layers;
+    sparse_array<player_tag>& _players;
+    sparse_array<enemy_tag>& _enemies;
+    sparse_array<boss_tag>& _bosses;
+    sparse_array<projectile_tag>& _projectiles;
+    sparse_array<ally_projectile_tag>& _ally_projectiles;
+    sparse_array<entity_tag>& _entity_tags;
+    sparse_array<serpent_part>& _serpent_parts;
+    sparse_array<homing_component>& _homings;
+};
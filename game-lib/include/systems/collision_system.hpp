@@ -1,5 +1,37 @@
 #pragma once
 
+#include "core/CommandBuffer.hpp"
 #include "ecs/registry.hpp"
+#include "systems/collision_events.hpp"
 
+/**
+ * @brief Find this tick's contacts and append them to @p events (cleared first).
+ *
+ * Reads components only; what one contact implies for the next (a consumed
+ * shot, a dead target, a knocked-out player) is tracked in scratch state.
+ *
+ * Boxes are swept back along velocity * @p dt, the motion that brought them
+ * to their current position, so fast shots cannot tunnel through thin targets
+ * between ticks; of several candidates the one touched earliest is hit. With
+ * a zero @p dt this is the plain end-of-tick overlap test.
+ */
+void detect_collisions(registry& reg, collision_event_buffer& events, float dt = 0.0f);
+
+/**
+ * @brief Apply @p events in stages: damage (appends killed events), explosions,
+ * scoring, then kills and knock-outs recorded into @p commands.
+ */
+void resolve_collisions(registry& reg, collision_event_buffer& events, engine::CommandBuffer& commands);
+
+/**
+ * @brief Detect then resolve; @p events keeps the tick's contacts and deaths afterwards.
+ */
+void collisionSystem(registry& reg, engine::CommandBuffer& commands, collision_event_buffer& events,
+                     float dt = 0.0f);
+
+void collisionSystem(registry& reg, engine::CommandBuffer& commands);
+
+/**
+ * @brief Standalone variant: records into a local buffer and flushes it before returning.
+ */
 void collisionSystem(registry& reg);
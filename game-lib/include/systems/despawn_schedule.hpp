@@ -0,0 +1,114 @@
+#pragma once
+
+#include "ecs/components.hpp"
+#include "ecs/entity.hpp"
+#include "ecs/registry.hpp"
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * @brief What cleanupSystem has to reap: entities that took lethal damage,
+ * lifetimes running out and movers that left the playfield.
+ *
+ * Lifetimes sit in a min-heap keyed by expiry time on the schedule's own
+ * clock, which cleanupSystem advances once per tick, so a tick only pops the
+ * entries that are due. The movement stage flags the entities it moved out of
+ * the playfield, and the damage paths flag the entities they killed;
+ * cleanupSystem then decides which of those to kill. Handles
+ * are checked for liveness when reaped, so entries for entities killed some
+ * other way are simply dropped.
+ *
+ * Stored as a registry singleton (see despawn_schedule_of) so factories that
+ * only get a registry can still queue lifetimes.
+ */
+class despawn_schedule {
+public:
+    /**
+     * @brief Box shot-type entities must stay in.
+     */
+    static bool inside_projectile_bounds(position const& pos) noexcept {
+        return pos.x >= 0.0f && pos.x <= 1920.0f && pos.y >= 0.0f && pos.y <= 1080.0f;
+    }
+
+    /**
+     * @brief Wider box for enemies, which enter from beyond the right edge.
+     */
+    static bool inside_enemy_bounds(position const& pos) noexcept {
+        return pos.x >= 0.0f && pos.x <= 2200.0f && pos.y >= -200.0f && pos.y <= 1300.0f;
+    }
+
+    /**
+     * @brief Reap @p e once @p lifetime seconds of the schedule clock have passed.
+     */
+    void expire_after(entity e, float lifetime) {
+        _timers.push_back(timer{_now + static_cast<double>(lifetime), e});
+        std::push_heap(_timers.begin(), _timers.end(), later);
+    }
+
+    /**
+     * @brief Advance the clock by @p dt and append every entity due by then to @p out.
+     */
+    void collect_expired(float dt, std::vector<entity>& out) {
+        _now += static_cast<double>(dt);
+        while (!_timers.empty() && _timers.front().expires_at <= _now) {
+            std::pop_heap(_timers.begin(), _timers.end(), later);
+            out.push_back(_timers.back().target);
+            _timers.pop_back();
+        }
+    }
+
+    /**
+     * @brief Note that @p e was moved outside inside_projectile_bounds().
+     */
+    void flag_out_of_bounds(entity e) { _out_of_bounds.push_back(e); }
+
+    /**
+     * @brief Entities flagged since the last clear_out_of_bounds().
+     */
+    std::vector<entity> const& out_of_bounds() const noexcept { return _out_of_bounds; }
+    void clear_out_of_bounds() noexcept { _out_of_bounds.clear(); }
+
+    /**
+     * @brief Note that @p e took lethal damage; flagging it twice is harmless.
+     */
+    void flag_death(entity e) { _deaths.push_back(e); }
+
+    /**
+     * @brief Entities flagged since the last clear_deaths(), sorted, each listed once.
+     */
+    std::vector<entity> const& unique_deaths() {
+        std::sort(_deaths.begin(), _deaths.end());
+        _deaths.erase(std::unique(_deaths.begin(), _deaths.end()), _deaths.end());
+        return _deaths;
+    }
+    void clear_deaths() noexcept { _deaths.clear(); }
+
+    std::size_t pending() const noexcept { return _timers.size(); }
+
+private:
+    struct timer {
+        double expires_at;
+        entity target;
+    };
+
+    static bool later(timer const& a, timer const& b) noexcept { return a.expires_at > b.expires_at; }
+
+    // Double: the schedule outlives game resets, and a float clock stops
+    // advancing by a 1/60 s tick after a few days of uptime.
+    double _now = 0.0;
+    std::vector<timer> _timers;
+    std::vector<entity> _out_of_bounds;
+    std::vector<entity> _deaths;
+};
+
+/**
+ * @brief The registry's despawn_schedule, created on first use.
+ */
+inline despawn_schedule& despawn_schedule_of(registry& reg) {
+    auto& schedules = reg.get_components<despawn_schedule>();
+    if (schedules.dense_size() == 0) {
+        reg.emplace_component<despawn_schedule>(reg.spawn_entity());
+    }
+    return schedules.dense_value(0);
+}
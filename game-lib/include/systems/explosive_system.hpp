@@ -1,5 +1,7 @@
 #pragma once
 
+#include "core/CommandBuffer.hpp"
 #include "ecs/registry.hpp"
 
+void explosiveProjectileSystem(registry& reg, float dt, engine::CommandBuffer& commands);
 void explosiveProjectileSystem(registry& reg, float dt);
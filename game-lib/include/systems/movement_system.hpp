@@ -1,5 +1,31 @@
 #pragma once
 
+#include "../level/LevelConfig.hpp"
+#include "components/logic_components.hpp"
 #include "ecs/registry.hpp"
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <vector>
 
-void movementSystem(registry& reg, float dt);
+/**
+ * @brief Per-session state of movementSystem: the pattern clock and the
+ * scratch buckets of patterned entities, kept to avoid reallocating.
+ */
+struct movement_state {
+    float elapsed = 0.0f;
+    std::array<std::vector<std::size_t>, movement_pattern::kind_count> buckets;
+};
+
+/**
+ * @brief Steer patterned entities (one tight loop per pattern kind), then
+ * move everything by velocity * @p dt and clamp bounded movers.
+ */
+void movementSystem(registry& reg, float dt, movement_state& state);
+
+/**
+ * @brief Pattern for a level's movement definition, or nullopt for straight
+ * ("linear") motion. Config amplitudes are in pixels and frequencies in
+ * radians (sine) or legs (zigzag) per second.
+ */
+std::optional<movement_pattern> makeMovementPattern(const rtype::level::MovementPatternConfig& config);
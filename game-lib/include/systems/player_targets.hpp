@@ -0,0 +1,74 @@
+#pragma once
+
+#include "components/logic_components.hpp"
+#include "ecs/components.hpp"
+#include "ecs/registry.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+/**
+ * @brief Snapshot of the live players' positions for code that aims at players.
+ *
+ * Refreshed once at a point of the tick where players have settled, then
+ * scanned by every shooter or homing missile instead of walking the player
+ * pools again. A player is live while it has player_tag and position, and
+ * health above zero if it has health. Targets are kept in ascending entity
+ * order, so ties go to the lowest index.
+ */
+class player_targets {
+public:
+    struct target {
+        std::size_t idx;
+        float x;
+        float y;
+    };
+
+    void refresh(registry& reg) {
+        auto& healths = reg.get_components<health>();
+        _targets.clear();
+        reg.view<player_tag, position>().each([&](std::size_t idx, player_tag&, position& pos) {
+            const health* hp = healths.find(idx);
+            if (hp == nullptr || hp->current > 0) {
+                _targets.push_back(target{idx, pos.x, pos.y});
+            }
+        });
+        std::sort(_targets.begin(), _targets.end(),
+                  [](target const& a, target const& b) { return a.idx < b.idx; });
+    }
+
+    /**
+     * @brief Closest target to (@p x, @p y) for which @p accept(dx, dy) holds,
+     * with (dx, dy) the offset from (@p x, @p y) to the target, or nullptr.
+     */
+    template <typename Filter>
+    const target* nearest(float x, float y, Filter&& accept) const {
+        const target* best = nullptr;
+        float best_dist_sq = 0.0f;
+        for (auto const& t : _targets) {
+            float dx = t.x - x;
+            float dy = t.y - y;
+            if (!accept(dx, dy)) {
+                continue;
+            }
+            float dist_sq = dx * dx + dy * dy;
+            if (best == nullptr || dist_sq < best_dist_sq) {
+                best = &t;
+                best_dist_sq = dist_sq;
+            }
+        }
+        return best;
+    }
+
+    const target* nearest(float x, float y) const {
+        return nearest(x, y, [](float, float) { return true; });
+    }
+
+    std::span<const target> all() const noexcept { return _targets; }
+    bool empty() const noexcept { return _targets.empty(); }
+
+private:
+    std::vector<target> _targets;
+};
@@ -1,6 +1,27 @@
 #pragma once
 
+#include "core/CommandBuffer.hpp"
 #include "ecs/registry.hpp"
+#include "systems/player_targets.hpp"
 
 void shootingSystem(registry& reg, float dt);
-void enemyShootingSystem(registry& reg, float dt);
+
+/**
+ * @brief Per-session state of enemyShootingSystem.
+ */
+struct enemy_shooting_state {
+    int enemy3_volleys = 0;  // Rotates the projectile types of Enemy3 bursts
+};
+
+/**
+ * @brief Fire every ready enemy weapon; aimed shots pick from @p players.
+ */
+void enemyShootingSystem(registry& reg, float dt, engine::CommandBuffer& commands,
+                         const player_targets& players, enemy_shooting_state& state);
+
+/**
+ * @brief Same, against a snapshot of the players taken now.
+ */
+void enemyShootingSystem(registry& reg, float dt, engine::CommandBuffer& commands,
+                         enemy_shooting_state& state);
+void enemyShootingSystem(registry& reg, float dt, enemy_shooting_state& state);
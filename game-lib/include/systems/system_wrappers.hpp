@@ -7,6 +7,10 @@
 #include "wave_system.hpp"
 #include "cleanup_system.hpp"
 #include "explosive_system.hpp"
+#include "despawn_schedule.hpp"
+#include "components/game_components.hpp"
+#include "components/logic_components.hpp"
+#include "ecs/components.hpp"
 
 
 class ShootingSystem : public engine::ISystem {
@@ -15,34 +19,96 @@ public:
     void update(registry& reg, float dt) override {
         shootingSystem(reg, dt);
     }
+    engine::SystemAccess access() const override {
+        return engine::SystemAccess().writes<weapon>();
+    }
     void shutdown([[maybe_unused]] registry& reg) override {}
 };
 
 class EnemyShootingSystem : public engine::ISystem {
 public:
+    /**
+     * @brief @p players, when given, is the owner's per-tick snapshot and must
+     * be refreshed before each update; otherwise one is taken every update.
+     */
+    explicit EnemyShootingSystem(const player_targets* players = nullptr) : _players(players) {}
+
     void init([[maybe_unused]] registry& reg) override {}
     void update(registry& reg, float dt) override {
-        enemyShootingSystem(reg, dt);
+        engine::CommandBuffer commands;
+        update_deferred(reg, dt, commands);
+        commands.flush(reg);
+    }
+    void update_deferred(registry& reg, float dt, engine::CommandBuffer& commands) override {
+        if (_players != nullptr) {
+            enemyShootingSystem(reg, dt, commands, *_players, _state);
+        } else {
+            enemyShootingSystem(reg, dt, commands, _state);
+        }
+    }
+    engine::SystemAccess access() const override {
+        auto access = engine::SystemAccess()
+                          .reads<enemy_tag, position, entity_tag, custom_attack_config>()
+                          .writes<weapon>();
+        if (_players == nullptr) {
+            // Snapshots the players itself.
+            access.reads<player_tag, health>();
+        }
+        return access;
     }
     void shutdown([[maybe_unused]] registry& reg) override {}
+
+private:
+    const player_targets* _players;
+    enemy_shooting_state _state;
 };
 
 class MovementSystem : public engine::ISystem {
 public:
-    void init([[maybe_unused]] registry& reg) override {}
+    void init(registry& reg) override { despawn_schedule_of(reg); }
     void update(registry& reg, float dt) override {
-        movementSystem(reg, dt);
+        movementSystem(reg, dt, _state);
+    }
+    engine::SystemAccess access() const override {
+        return engine::SystemAccess()
+            .reads<movement_pattern, bounded_movement>()
+            .writes<position, velocity, despawn_schedule>();
     }
     void shutdown([[maybe_unused]] registry& reg) override {}
+
+private:
+    movement_state _state;
 };
 
 class CollisionSystem : public engine::ISystem {
 public:
     void init([[maybe_unused]] registry& reg) override {}
-    void update(registry& reg, [[maybe_unused]] float dt) override {
-        collisionSystem(reg);
+    void update(registry& reg, float dt) override {
+        engine::CommandBuffer commands;
+        collisionSystem(reg, commands, _events, dt);
+        commands.flush(reg);
+    }
+    void update_deferred(registry& reg, float dt, engine::CommandBuffer& commands) override {
+        collisionSystem(reg, commands, _events, dt);
+    }
+    engine::SystemAccess access() const override {
+        return engine::SystemAccess()
+            .reads<position, velocity, collision_layer, player_tag, enemy_tag, boss_tag,
+                   projectile_tag, ally_projectile_tag, entity_tag, serpent_part,
+                   homing_component, multi_hitbox, damage_on_contact, shield, game_settings>()
+            .writes<health, collision_box, sprite_component, damage_flash_component,
+                    laser_damage_immunity, serpent_boss_controller, level_manager,
+                    despawn_schedule>();
     }
     void shutdown([[maybe_unused]] registry& reg) override {}
+
+    /**
+     * @brief Contacts and deaths of the last update, e.g. for hit broadcasts.
+     */
+    const collision_event_buffer& events() const { return _events; }
+
+private:
+    collision_event_buffer _events;
 };
 
 class WaveSystem : public engine::ISystem {
@@ -51,15 +117,31 @@ public:
     void update(registry& reg, float dt) override {
         waveSystem(reg, dt);
     }
+    void update_deferred(registry& reg, float dt, engine::CommandBuffer& commands) override {
+        waveSystem(reg, dt, commands);
+    }
+    engine::SystemAccess access() const override {
+        return engine::SystemAccess().writes<wave_manager, level_manager>();
+    }
     void shutdown([[maybe_unused]] registry& reg) override {}
 };
 
 class CleanupSystem : public engine::ISystem {
 public:
-    void init([[maybe_unused]] registry& reg) override {}
+    // Created here so no update spawns the schedule mid-stage.
+    void init(registry& reg) override { despawn_schedule_of(reg); }
     void update(registry& reg, float dt) override {
         cleanupSystem(reg, dt);
     }
+    void update_deferred(registry& reg, float dt, engine::CommandBuffer& commands) override {
+        cleanupSystem(reg, dt, commands);
+    }
+    engine::SystemAccess access() const override {
+        return engine::SystemAccess()
+            .reads<health, position, enemy_tag, player_tag, serpent_part, entity_tag,
+                   projectile_tag>()
+            .writes<despawn_schedule>();
+    }
     void shutdown([[maybe_unused]] registry& reg) override {}
 };
 
@@ -69,5 +151,13 @@ public:
     void update(registry& reg, float dt) override {
         explosiveProjectileSystem(reg, dt);
     }
+    void update_deferred(registry& reg, float dt, engine::CommandBuffer& commands) override {
+        explosiveProjectileSystem(reg, dt, commands);
+    }
+    engine::SystemAccess access() const override {
+        return engine::SystemAccess()
+            .reads<position, player_tag, shield>()
+            .writes<explosive_projectile, health, despawn_schedule>();
+    }
     void shutdown([[maybe_unused]] registry& reg) override {}
 };
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "components/logic_components.hpp"
+#include "ecs/components.hpp"
+#include "ecs/registry.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Resolves transform_link positions in one sweep, parents first.
+ *
+ * The sweep order (links sorted by depth) is cached and rebuilt only when the
+ * set of linked entities or any link's parent changes, so a steady multi-part
+ * boss costs one pass over its links per update. Offsets and parents may be
+ * edited in place between updates.
+ */
+class transform_hierarchy {
+public:
+    void update(registry& reg) {
+        auto& links = reg.get_components<transform_link>();
+        auto& positions = reg.get_components<position>();
+        if (links.dense_indices() != _linked || parents_changed(links)) {
+            rebuild(reg, links);
+        }
+
+        for (std::size_t slot : _order) {
+            transform_link const& link = links.dense_value(slot);
+            if (!reg.is_alive(link.parent)) {
+                continue;
+            }
+            const position* parent_pos = positions.find(link.parent.id());
+            position* child_pos = positions.find(links.dense_index(slot));
+            if (parent_pos == nullptr || child_pos == nullptr) {
+                continue;
+            }
+            child_pos->x = parent_pos->x + link.offset_x;
+            child_pos->y = parent_pos->y + link.offset_y;
+        }
+    }
+
+private:
+    // Only called once the linked set matched, so slots line up with _parents.
+    bool parents_changed(sparse_array<transform_link> const& links) const {
+        for (std::size_t slot = 0; slot < _parents.size(); ++slot) {
+            if (links.dense_value(slot).parent != _parents[slot]) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void rebuild(registry& reg, sparse_array<transform_link>& links) {
+        _linked = links.dense_indices();
+        std::size_t count = _linked.size();
+
+        _parents.clear();
+        for (std::size_t slot = 0; slot < count; ++slot) {
+            _parents.push_back(links.dense_value(slot).parent);
+        }
+
+        _depths.assign(count, 0);
+        for (std::size_t slot = 0; slot < count; ++slot) {
+            // Bounded by the link count so a cycle cannot hang the walk.
+            entity parent = links.dense_value(slot).parent;
+            std::size_t depth = 0;
+            while (depth < count && reg.is_alive(parent)) {
+                const transform_link* up = links.find(parent.id());
+                if (up == nullptr) {
+                    break;
+                }
+                parent = up->parent;
+                ++depth;
+            }
+            _depths[slot] = depth;
+        }
+
+        _order.resize(count);
+        for (std::size_t slot = 0; slot < count; ++slot) {
+            _order[slot] = slot;
+        }
+        std::stable_sort(_order.begin(), _order.end(),
+                         [this](std::size_t a, std::size_t b) { return _depths[a] < _depths[b]; });
+    }
+
+    std::vector<std::size_t> _linked;
+    std::vector<entity> _parents;
+    std::vector<std::size_t> _depths;
+    std::vector<std::size_t> _order;
+};
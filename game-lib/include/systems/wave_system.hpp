@@ -1,6 +1,8 @@
 #pragma once
 
+#include "core/CommandBuffer.hpp"
 #include "ecs/registry.hpp"
 
+void waveSystem(registry& reg, float dt, engine::CommandBuffer& commands);
 void waveSystem(registry& reg, float dt);
 
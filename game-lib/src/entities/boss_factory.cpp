@@ -20,6 +20,7 @@ entity createBoss(registry& reg, float x, float y, int boss_type) {
     reg.register_component<damage_on_contact>();
     reg.register_component<collision_box>();
     reg.register_component<boss_tag>();
+    reg.register_component<collision_layer>();
     reg.register_component<entity_tag>();
 
     int boss_health = 1000;
@@ -48,6 +49,7 @@ entity createBoss(registry& reg, float x, float y, int boss_type) {
     reg.add_component(boss, collision_box{boss_width, boss_height, 0.0f, 0.0f});
     
     reg.add_component(boss, boss_tag{});
+    reg.add_component(boss, collision_layer::boss());
     reg.add_component(boss, entity_tag{RType::EntityType::Boss});
 
     std::cout << "[BOSS FACTORY] All components added successfully" << std::endl;
@@ -6,20 +6,16 @@
 
 static float get_difficulty_multiplier(registry& reg) {
     auto& settings = reg.get_components<game_settings>();
-    for (const auto& setting : settings) {
-        if (setting.has_value()) {
-            return setting->difficulty_multiplier;
-        }
+    if (settings.dense_size() > 0) {
+        return settings.dense_value(0).difficulty_multiplier;
     }
     return 1.0f;
 }
 
 static int get_current_level(registry& reg) {
     auto& level_managers = reg.get_components<level_manager>();
-    for (const auto& lvl_mgr : level_managers) {
-        if (lvl_mgr.has_value()) {
-            return lvl_mgr->current_level;
-        }
+    if (level_managers.dense_size() > 0) {
+        return level_managers.dense_value(0).current_level;
     }
     return 1;
 }
@@ -42,6 +38,7 @@ entity createBasicEnemy(registry& reg, float x, float y) {
     reg.register_component<collision_box>();
     reg.register_component<damage_on_contact>();
     reg.register_component<enemy_tag>();
+    reg.register_component<collision_layer>();
     reg.register_component<entity_tag>();
     reg.register_component<weapon>();
 
@@ -61,7 +58,7 @@ entity createBasicEnemy(registry& reg, float x, float y) {
     reg.add_component(enemy, weapon{0.5f, 300.0f, 15});
 
     sprite_component sprite;
-    sprite.texture_path = "assets/r-typesheet26.png";
+    sprite.set_texture("assets/r-typesheet26.png");
     sprite.texture_rect_x = 0;
     sprite.texture_rect_y = 0;
     sprite.texture_rect_w = 65;
@@ -82,6 +79,7 @@ entity createBasicEnemy(registry& reg, float x, float y) {
     reg.add_component(enemy, collision_box{60.0f, 45.0f});
     reg.add_component(enemy, damage_on_contact{scaled_damage, false});
     reg.add_component(enemy, enemy_tag{});
+    reg.add_component(enemy, collision_layer::enemy());
     reg.add_component(enemy, entity_tag{RType::EntityType::Enemy});
 
     return enemy;
@@ -98,6 +96,7 @@ entity createSecondaryEnemy(registry& reg, float x, float y) {
     reg.register_component<collision_box>();
     reg.register_component<damage_on_contact>();
     reg.register_component<enemy_tag>();
+    reg.register_component<collision_layer>();
     reg.register_component<entity_tag>();
     reg.register_component<weapon>();
 
@@ -117,7 +116,7 @@ entity createSecondaryEnemy(registry& reg, float x, float y) {
     reg.add_component(enemy, weapon{0.7f, 250.0f, 20});
 
     sprite_component sprite;
-    sprite.texture_path = "assets/r-typesheet24.png";
+    sprite.set_texture("assets/r-typesheet24.png");
     sprite.texture_rect_x = 0;
     sprite.texture_rect_y = 0;
     sprite.texture_rect_w = 65;
@@ -141,6 +140,7 @@ entity createSecondaryEnemy(registry& reg, float x, float y) {
     reg.add_component(enemy, collision_box{60.0f, 60.0f});
     reg.add_component(enemy, damage_on_contact{scaled_damage, false});
     reg.add_component(enemy, enemy_tag{});
+    reg.add_component(enemy, collision_layer::enemy());
     reg.add_component(enemy, entity_tag{RType::EntityType::Enemy2});
 
     return enemy;
@@ -163,7 +163,9 @@ entity createFlyingEnemy(registry& reg, float x, float y) {
     reg.register_component<collision_box>();
     reg.register_component<damage_on_contact>();
     reg.register_component<enemy_tag>();
+    reg.register_component<collision_layer>();
     reg.register_component<entity_tag>();
+    reg.register_component<movement_pattern>();
     reg.register_component<weapon>();
 
     reg.add_component(enemy, position{x, y});
@@ -174,7 +176,7 @@ entity createFlyingEnemy(registry& reg, float x, float y) {
     reg.add_component(enemy, weapon{fire_rate_flying, 400.0f, scaled_weapon_damage});
 
     sprite_component sprite;
-    sprite.texture_path = "assets/r-typesheet14-1.gif";
+    sprite.set_texture("assets/r-typesheet14-1.gif");
     sprite.texture_rect_x = 62;
     sprite.texture_rect_y = 0;
     sprite.texture_rect_w = 68;
@@ -196,7 +198,9 @@ entity createFlyingEnemy(registry& reg, float x, float y) {
     reg.add_component(enemy, collision_box{70.0f, 80.0f});
     reg.add_component(enemy, damage_on_contact{scaled_damage, false});
     reg.add_component(enemy, enemy_tag{});
+    reg.add_component(enemy, collision_layer::enemy());
     reg.add_component(enemy, entity_tag{RType::EntityType::FlyingEnemy});
+    reg.add_component(enemy, movement_pattern::sine(80.0f, 4.0f, static_cast<float>(enemy.id()) * 0.3f));
 
     return enemy;
 }
@@ -219,7 +223,9 @@ entity createWaveEnemy(registry& reg, float x, float y) {
     reg.register_component<collision_box>();
     reg.register_component<damage_on_contact>();
     reg.register_component<enemy_tag>();
+    reg.register_component<collision_layer>();
     reg.register_component<entity_tag>();
+    reg.register_component<movement_pattern>();
     reg.register_component<weapon>();
 
     reg.add_component(enemy, position{x, y});
@@ -230,7 +236,7 @@ entity createWaveEnemy(registry& reg, float x, float y) {
     reg.add_component(enemy, weapon{fire_rate_wave, 500.0f, scaled_weapon_damage});
 
     sprite_component sprite;
-    sprite.texture_path = "assets/r-typesheet9-1.gif";
+    sprite.set_texture("assets/r-typesheet9-1.gif");
     sprite.texture_rect_x = 56;
     sprite.texture_rect_y = 0;
     sprite.texture_rect_w = 55;
@@ -250,7 +256,9 @@ entity createWaveEnemy(registry& reg, float x, float y) {
     reg.add_component(enemy, collision_box{55.0f, 60.0f});
     reg.add_component(enemy, damage_on_contact{scaled_damage, false});
     reg.add_component(enemy, enemy_tag{});
+    reg.add_component(enemy, collision_layer::enemy());
     reg.add_component(enemy, entity_tag{RType::EntityType::Enemy4});
+    reg.add_component(enemy, movement_pattern::sine(100.0f, 3.0f, 0.0f, 0.01f));
 
     return enemy;
 }
@@ -273,7 +281,9 @@ entity createTankEnemy(registry& reg, float x, float y) {
     reg.register_component<collision_box>();
     reg.register_component<damage_on_contact>();
     reg.register_component<enemy_tag>();
+    reg.register_component<collision_layer>();
     reg.register_component<entity_tag>();
+    reg.register_component<movement_pattern>();
     reg.register_component<weapon>();
 
     reg.add_component(enemy, position{x, y});
@@ -284,7 +294,7 @@ entity createTankEnemy(registry& reg, float x, float y) {
     reg.add_component(enemy, weapon{fire_rate_tank, 450.0f, scaled_weapon_damage});
 
     sprite_component sprite;
-    sprite.texture_path = "assets/r-typesheet7.gif";
+    sprite.set_texture("assets/r-typesheet7.gif");
     sprite.texture_rect_x = 66;
     sprite.texture_rect_y = 34;
     sprite.texture_rect_w = 33;
@@ -304,7 +314,9 @@ entity createTankEnemy(registry& reg, float x, float y) {
     reg.add_component(enemy, collision_box{60.0f, 60.0f});
     reg.add_component(enemy, damage_on_contact{scaled_damage, false});
     reg.add_component(enemy, enemy_tag{});
+    reg.add_component(enemy, collision_layer::enemy());
     reg.add_component(enemy, entity_tag{RType::EntityType::Enemy5});
+    reg.add_component(enemy, movement_pattern::zigzag(150.0f, 1.0f, static_cast<float>(enemy.id()) * 0.5f));
 
     return enemy;
 }
@@ -1,34 +1,44 @@
 #include "entities/explosion_factory.hpp"
 #include "ecs/components.hpp"
+#include "ecs/prefab.hpp"
 #include "components/game_components.hpp"
+#include "systems/despawn_schedule.hpp"
 
-entity createExplosion(registry& reg, float x, float y) {
-    entity explosion = reg.spawn_entity();
+namespace {
 
-    reg.register_component<position>();
-    reg.register_component<sprite_component>();
-    reg.register_component<animation_component>();
-    reg.register_component<explosion_tag>();
-    reg.register_component<entity_tag>();
+using explosion_prefab = prefab<position, sprite_component, animation_component, explosion_tag, entity_tag>;
 
-    reg.add_component(explosion, position{x, y});
+const explosion_prefab& explosionPrefab() {
+    static const explosion_prefab explosion{
+        position{},
+        sprite_component{std::make_shared<const std::string>("assets/explosion.gif"), 0, 0, 34, 38, 2.0f},
+        animation_component{make_frame_table({
+                                {0, 0, 34, 38},
+                                {34, 0, 33, 38},
+                                {67, 0, 35, 38},
+                                {102, 0, 34, 38},
+                                {136, 0, 35, 38},
+                                {171, 0, 35, 38}
+                            }),
+                            0.08f, false},
+        explosion_tag{0.25f},
+        entity_tag{RType::EntityType::Obstacle}};
+    return explosion;
+}
 
-    std::vector<sf::IntRect> explosion_frames = {
-        {0, 0, 34, 38},
-        {34, 0, 33, 38},
-        {67, 0, 35, 38},
-        {102, 0, 34, 38},
-        {136, 0, 35, 38},
-        {171, 0, 35, 38}
-    };
+}  // namespace
 
-    reg.add_component(explosion,
-                      sprite_component{"assets/explosion.gif", 0, 0, 34, 38, 2.0f});
-    
-    animation_component anim(explosion_frames, 0.08f, false);
+entity createExplosion(registry& reg, float x, float y) {
+    const explosion_prefab& explosion = explosionPrefab();
+    entity e = explosion.instantiate(reg, position{x, y});
+    despawn_schedule_of(reg).expire_after(e, explosion.get<explosion_tag>().lifetime);
+    return e;
+}
 
-    reg.add_component(explosion, explosion_tag{0.5f});
-    reg.add_component(explosion, entity_tag{RType::EntityType::Obstacle});
+void createExplosion(engine::CommandBuffer& commands, float x, float y) {
+    commands.defer([x, y](registry& reg) { createExplosion(reg, x, y); });
+}
 
-    return explosion;
+void reserveExplosions(registry& reg, std::size_t count) {
+    explosionPrefab().reserve(reg, count);
 }
@@ -14,6 +14,7 @@ entity createPlayer(registry& reg, float x, float y, int player_index) {
     reg.register_component<animation_component>();
     reg.register_component<collision_box>();
     reg.register_component<player_tag>();
+    reg.register_component<collision_layer>();
     reg.register_component<bounded_movement>();
     reg.register_component<player_index_component>();
     reg.register_component<laser_damage_immunity>();
@@ -34,6 +35,7 @@ entity createPlayer(registry& reg, float x, float y, int player_index) {
     reg.add_component(player, animation_component{player_frames, 0.15f, true});
     reg.add_component(player, collision_box{48.0f, 24.0f});
     reg.add_component(player, player_tag{});
+    reg.add_component(player, collision_layer::player());
     reg.add_component(player, bounded_movement{0.0f, 1920.0f, 0.0f, 1080.0f});
     reg.add_component(player, player_index_component{player_index});
     reg.add_component(player, laser_damage_immunity{0.2f});
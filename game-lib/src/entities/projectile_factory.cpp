@@ -1,35 +1,141 @@
 #include "entities/projectile_factory.hpp"
 #include "ecs/components.hpp"
+#include "ecs/prefab.hpp"
 #include "components/game_components.hpp"
 #include <cmath>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using player_projectile_prefab = prefab<position, velocity, sprite_component, animation_component,
+                                        collision_box, damage_on_contact, projectile_tag, entity_tag,
+                                        collision_layer>;
+using enemy_projectile_prefab = prefab<position, velocity, sprite_component, animation_component,
+                                       collision_box, damage_on_contact, projectile_tag, entity_tag,
+                                       enemy_tag, collision_layer>;
+using custom_projectile_prefab = prefab<position, velocity, sprite_component, animation_component,
+                                        collision_box, damage_on_contact, projectile_tag, entity_tag,
+                                        enemy_tag, collision_layer, custom_entity_id>;
+
+std::shared_ptr<const std::string> sharedPath(const char* path) {
+    return std::make_shared<const std::string>(path);
+}
 
-entity createProjectile(registry& reg, float x, float y, float vx, float vy, int damage, 
-                        WeaponUpgradeType upgrade_type, bool power_cannon_active, bool is_drone_projectile) {
-    entity projectile = reg.spawn_entity();
+player_projectile_prefab makePlayerProjectile(const char* texture, sf::IntRect rect, float scale,
+                                              std::vector<sf::IntRect> frames, float collision_w,
+                                              float collision_h) {
+    return player_projectile_prefab{
+        position{},
+        velocity{},
+        sprite_component{sharedPath(texture), rect.left, rect.top, rect.width, rect.height, scale},
+        animation_component{make_frame_table(std::move(frames)), 0.08f, true},
+        collision_box{collision_w, collision_h},
+        damage_on_contact{},
+        projectile_tag{},
+        entity_tag{RType::EntityType::Projectile},
+        collision_layer::player_projectile()};
+}
+
+enemy_projectile_prefab makeEnemyProjectile(const char* texture, sf::IntRect rect, float scale,
+                                            std::vector<sf::IntRect> frames, float frame_duration,
+                                            bool loop, float collision_w, float collision_h,
+                                            RType::EntityType type = RType::EntityType::Projectile) {
+    return enemy_projectile_prefab{
+        position{},
+        velocity{},
+        sprite_component{sharedPath(texture), rect.left, rect.top, rect.width, rect.height, scale},
+        animation_component{make_frame_table(std::move(frames)), frame_duration, loop},
+        collision_box{collision_w, collision_h},
+        damage_on_contact{},
+        projectile_tag{},
+        entity_tag{type},
+        enemy_tag{},
+        collision_layer::enemy_projectile()};
+}
+
+const enemy_projectile_prefab& enemyShotPrefab() {
+    static const enemy_projectile_prefab shot = makeEnemyProjectile(
+        "assets/r-typesheet1.png", {248, 102, 15, 17}, 2.0f, {{248, 102, 15, 17}, {263, 102, 15, 17}},
+        0.08f, true, 20.0f, 20.0f);
+    return shot;
+}
+
+bool sameProjectile(const custom_attack_config& a, const custom_attack_config& b) {
+    return a.projectile_texture == b.projectile_texture &&
+           a.projectile_frame_width == b.projectile_frame_width &&
+           a.projectile_frame_height == b.projectile_frame_height &&
+           a.projectile_frame_count == b.projectile_frame_count &&
+           a.projectile_frame_duration == b.projectile_frame_duration &&
+           a.projectile_scale == b.projectile_scale && a.projectile_mirror_x == b.projectile_mirror_x &&
+           a.projectile_mirror_y == b.projectile_mirror_y &&
+           a.projectile_rotation == b.projectile_rotation;
+}
+
+custom_projectile_prefab makeCustomProjectile(const custom_attack_config& config) {
+    std::vector<sf::IntRect> frames;
+    for (int i = 0; i < config.projectile_frame_count; ++i) {
+        frames.push_back({i * config.projectile_frame_width, 0, config.projectile_frame_width,
+                          config.projectile_frame_height});
+    }
+
+    auto texture = std::make_shared<const std::string>(config.projectile_texture);
+    sprite_component sprite{texture, 0, 0, config.projectile_frame_width,
+                            config.projectile_frame_height, config.projectile_scale};
+    sprite.mirror_x = config.projectile_mirror_x;
+    sprite.mirror_y = config.projectile_mirror_y;
+    sprite.rotation = config.projectile_rotation;
+
+    float collision_w = static_cast<float>(config.projectile_frame_width) * config.projectile_scale * 0.8f;
+    float collision_h = static_cast<float>(config.projectile_frame_height) * config.projectile_scale * 0.8f;
+
+    return custom_projectile_prefab{
+        position{},
+        velocity{},
+        sprite,
+        animation_component{make_frame_table(std::move(frames)), config.projectile_frame_duration, true},
+        collision_box{collision_w, collision_h},
+        damage_on_contact{},
+        projectile_tag{},
+        entity_tag{RType::EntityType::CustomProjectile},
+        enemy_tag{},
+        collision_layer::enemy_projectile(),
+        custom_entity_id{texture}};
+}
+
+/**
+ * @brief Prefab for the projectile @p config describes, built on its first shot.
+ */
+const custom_projectile_prefab& customProjectilePrefab(const custom_attack_config& config) {
+    // Per thread since lobbies may tick on different threads; a level only
+    // defines a handful of projectiles, so a linear lookup is enough.
+    thread_local std::vector<std::pair<custom_attack_config, custom_projectile_prefab>> prefabs;
+    for (auto const& [key, shot] : prefabs) {
+        if (sameProjectile(key, config)) {
+            return shot;
+        }
+    }
+    prefabs.emplace_back(config, makeCustomProjectile(config));
+    return prefabs.back().second;
+}
 
-    reg.register_component<position>();
-    reg.register_component<velocity>();
-    reg.register_component<sprite_component>();
-    reg.register_component<animation_component>();
-    reg.register_component<collision_box>();
-    reg.register_component<damage_on_contact>();
-    reg.register_component<projectile_tag>();
-    reg.register_component<entity_tag>();
-    reg.register_component<ally_projectile_tag>();
+}  // namespace
 
-    std::vector<sf::IntRect> projectile_frames = {
-        {231, 102, 16, 17},
-        {231 + 16, 102, 16, 17}
-    };
+entity createProjectile(registry& reg, float x, float y, float vx, float vy, int damage, 
+                        WeaponUpgradeType upgrade_type, bool power_cannon_active, bool is_drone_projectile) {
+    static const player_projectile_prefab normal_shot = makePlayerProjectile(
+        "assets/r-typesheet1.png", {231, 102, 16, 17}, 2.0f, {{231, 102, 16, 17}, {231 + 16, 102, 16, 17}},
+        24.0f, 24.0f);
+    static const player_projectile_prefab missile = makePlayerProjectile(
+        "assets/missile.png", {0, 0, 18, 17}, 2.5f, {{0, 0, 18, 17}}, 45.0f, 42.0f);
+    static const player_projectile_prefab cannon_shot = makePlayerProjectile(
+        "assets/canonpowerup.png", {0, 0, 51, 21}, 2.0f, {{0, 0, 51, 21}, {52, 0, 51, 21}}, 102.0f, 42.0f);
+    static const player_projectile_prefab power_shot = makePlayerProjectile(
+        "assets/r-typesheet1.png", {231, 102, 16, 17}, 3.5f, {{264, 102, 16, 17}, {280, 102, 16, 17}},
+        42.0f, 42.0f);
 
-    std::string texture_path = "assets/r-typesheet1.png";
-    int texture_x = 231;
-    int texture_y = 102;
-    int texture_w = 16;
-    int texture_h = 17;
-    float scale = 2.0f;
-    float collision_w = 24.0f;
-    float collision_h = 24.0f;
     float final_vx = vx;
     float final_vy = vy;
 
@@ -40,392 +146,87 @@ entity createProjectile(registry& reg, float x, float y, float vx, float vy, int
 
     float projectile_speed = std::sqrt(final_vx * final_vx + final_vy * final_vy);
 
+    const player_projectile_prefab* shot = &normal_shot;
     if (upgrade_type == WeaponUpgradeType::AllyMissile) {
-        texture_path = "assets/missile.png";
-        texture_x = 0;
-        texture_y = 0;
-        texture_w = 18;
-        texture_h = 17;
-        projectile_frames = {
-            {0, 0, 18, 17}
-        };
-        scale = 2.5f;
-        collision_w = 45.0f;
-        collision_h = 42.0f;
+        shot = &missile;
     } else if (projectile_speed > 600.0f) {
-        texture_path = "assets/canonpowerup.png";
-        texture_x = 0;
-        texture_y = 0;
-        texture_w = 51;
-        texture_h = 21;
-        projectile_frames = {
-            {0, 0, 51, 21},
-            {52, 0, 51, 21}
-        };
-        scale = 2.0f;
-        collision_w = 102.0f;
-        collision_h = 42.0f;
+        shot = &cannon_shot;
     } else if (upgrade_type == WeaponUpgradeType::PowerShot) {
-        scale = 3.5f;
-        collision_w = 42.0f;
-        collision_h = 42.0f;
-        projectile_frames = {
-            {264, 102, 16, 17},
-            {280, 102, 16, 17}
-        };
+        shot = &power_shot;
     }
 
-    reg.add_component(projectile, position{x, y});
-    reg.add_component(projectile, velocity{final_vx, final_vy});
-    reg.add_component(projectile,
-                      sprite_component{texture_path, texture_x, texture_y, texture_w, texture_h, scale});
-    reg.add_component(projectile,
-                      animation_component{projectile_frames, 0.08f, true});
-    reg.add_component(projectile, collision_box{collision_w, collision_h});
-    reg.add_component(projectile, damage_on_contact{damage, true});
-    reg.add_component(projectile, projectile_tag{});
-    reg.add_component(projectile, entity_tag{RType::EntityType::Projectile});
-
-    if (is_drone_projectile) {
-        reg.add_component(projectile, ally_projectile_tag{});
+    position pos{x, y};
+    velocity vel{final_vx, final_vy};
+    damage_on_contact contact{damage, true};
+    if (!is_drone_projectile) {
+        return shot->instantiate(reg, pos, vel, contact);
     }
 
+    entity projectile = shot->instantiate(reg, pos, vel, contact, collision_layer::ally_projectile());
+    reg.add_component(projectile, ally_projectile_tag{});
     return projectile;
 }
 
 entity createEnemyProjectile(registry& reg, float x, float y, float vx, float vy, int damage) {
-    entity projectile = reg.spawn_entity();
-
-    reg.register_component<position>();
-    reg.register_component<velocity>();
-    reg.register_component<sprite_component>();
-    reg.register_component<animation_component>();
-    reg.register_component<collision_box>();
-    reg.register_component<damage_on_contact>();
-    reg.register_component<projectile_tag>();
-    reg.register_component<entity_tag>();
-    reg.register_component<enemy_tag>();
-
-    std::vector<sf::IntRect> enemy_projectile_frames = {
-        {248, 102, 15, 17},
-        {263, 102, 15, 17}
-    };
-
-    float scale = 2.0f;
-    float collision_w = 20.0f;
-    float collision_h = 20.0f;
-
-    reg.add_component(projectile, position{x, y});
-    reg.add_component(projectile, velocity{vx, vy});
-    reg.add_component(projectile,
-                      sprite_component{"assets/r-typesheet1.png", 248, 102, 15, 17, scale});
-    reg.add_component(projectile,
-                      animation_component{enemy_projectile_frames, 0.08f, true});
-    reg.add_component(projectile, collision_box{collision_w, collision_h});
-    reg.add_component(projectile, damage_on_contact{damage, true});
-    reg.add_component(projectile, projectile_tag{});
-    reg.add_component(projectile, entity_tag{RType::EntityType::Projectile});
-    reg.add_component(projectile, enemy_tag{});
-
-    return projectile;
+    return enemyShotPrefab().instantiate(reg, position{x, y}, velocity{vx, vy}, damage_on_contact{damage, true});
 }
 
 entity createEnemy2Projectile(registry& reg, float x, float y, float vx, float vy, int damage) {
-    entity projectile = reg.spawn_entity();
-
-    reg.register_component<position>();
-    reg.register_component<velocity>();
-    reg.register_component<sprite_component>();
-    reg.register_component<animation_component>();
-    reg.register_component<collision_box>();
-    reg.register_component<damage_on_contact>();
-    reg.register_component<projectile_tag>();
-    reg.register_component<entity_tag>();
-    reg.register_component<enemy_tag>();
-
-    std::vector<sf::IntRect> enemy2_projectile_frames = {
-        {0, 0, 18, 19},
-        {18, 0, 18, 19}
-    };
-
-    float scale = 2.0f;
-    float collision_w = 30.0f;
-    float collision_h = 30.0f;
-
-    reg.add_component(projectile, position{x, y});
-    reg.add_component(projectile, velocity{vx, vy});
-    reg.add_component(projectile,
-                      sprite_component{"assets/ennemi-projectile.png", 0, 0, 18, 19, scale});
-    reg.add_component(projectile,
-                      animation_component{enemy2_projectile_frames, 0.1f, true});
-    reg.add_component(projectile, collision_box{collision_w, collision_h});
-    reg.add_component(projectile, damage_on_contact{damage, true});
-    reg.add_component(projectile, projectile_tag{});
-    reg.add_component(projectile, entity_tag{RType::EntityType::Projectile});
-    reg.add_component(projectile, enemy_tag{});
-
-    return projectile;
+    static const enemy_projectile_prefab shot = makeEnemyProjectile(
+        "assets/ennemi-projectile.png", {0, 0, 18, 19}, 2.0f, {{0, 0, 18, 19}, {18, 0, 18, 19}},
+        0.1f, true, 30.0f, 30.0f);
+    return shot.instantiate(reg, position{x, y}, velocity{vx, vy}, damage_on_contact{damage, true});
 }
 
 entity createCustomProjectile(registry& reg, float x, float y, float vx, float vy, int damage,
                                const custom_attack_config& config) {
-    entity projectile = reg.spawn_entity();
-
-    reg.register_component<position>();
-    reg.register_component<velocity>();
-    reg.register_component<sprite_component>();
-    reg.register_component<animation_component>();
-    reg.register_component<collision_box>();
-    reg.register_component<damage_on_contact>();
-    reg.register_component<projectile_tag>();
-    reg.register_component<entity_tag>();
-    reg.register_component<enemy_tag>();
-
-    std::vector<sf::IntRect> custom_projectile_frames;
-    for (int i = 0; i < config.projectile_frame_count; ++i) {
-        custom_projectile_frames.push_back({
-            i * config.projectile_frame_width, 0,
-            config.projectile_frame_width, config.projectile_frame_height
-        });
-    }
-
-    float collision_w = static_cast<float>(config.projectile_frame_width) * config.projectile_scale * 0.8f;
-    float collision_h = static_cast<float>(config.projectile_frame_height) * config.projectile_scale * 0.8f;
-
-    reg.add_component(projectile, position{x, y});
-    reg.add_component(projectile, velocity{vx, vy});
-    
-    sprite_component sprite;
-    sprite.texture_path = config.projectile_texture;
-    sprite.texture_rect_x = 0;
-    sprite.texture_rect_y = 0;
-    sprite.texture_rect_w = config.projectile_frame_width;
-    sprite.texture_rect_h = config.projectile_frame_height;
-    sprite.scale = config.projectile_scale;
-    sprite.mirror_x = config.projectile_mirror_x;
-    sprite.mirror_y = config.projectile_mirror_y;
-    sprite.rotation = config.projectile_rotation;
-    reg.add_component(projectile, sprite);
-    
-    reg.add_component(projectile,
-                      animation_component{custom_projectile_frames, config.projectile_frame_duration, true});
-    reg.add_component(projectile, collision_box{collision_w, collision_h});
-    reg.add_component(projectile, damage_on_contact{damage, true});
-    reg.add_component(projectile, projectile_tag{});
-    reg.add_component(projectile, entity_tag{RType::EntityType::CustomProjectile});
-    reg.add_component(projectile, enemy_tag{});
-    
-    reg.add_component(projectile, custom_entity_id{config.projectile_texture});
-
-    return projectile;
+    return customProjectilePrefab(config).instantiate(reg, position{x, y}, velocity{vx, vy},
+                                                      damage_on_contact{damage, true});
 }
 
 entity createEnemy3Projectile(registry& reg, float x, float y, float vx, float vy, int damage, [[maybe_unused]] int projectile_type) {
-    entity projectile = reg.spawn_entity();
-
-    reg.register_component<position>();
-    reg.register_component<velocity>();
-    reg.register_component<sprite_component>();
-    reg.register_component<animation_component>();
-    reg.register_component<collision_box>();
-    reg.register_component<damage_on_contact>();
-    reg.register_component<projectile_tag>();
-    reg.register_component<entity_tag>();
-    reg.register_component<enemy_tag>();
-
-    std::vector<sf::IntRect> projectile_frames = {
-        {48, 0, 16, 14},
-        {32, 0, 16, 14},
-        {16, 0, 16, 14},
-        {0, 0, 16, 14}
-    };
-    int texture_x = 0;
-    int texture_y = 0;
-    int texture_w = 16;
-    int texture_h = 14;
-    float scale = 2.5f;
-    float collision_w = 35.0f;
-    float collision_h = 35.0f;
-
-    reg.add_component(projectile, position{x, y});
-    reg.add_component(projectile, velocity{vx, vy});
-    reg.add_component(projectile,
-                      sprite_component{"assets/r-typesheet14-22.gif", texture_x, texture_y, texture_w, texture_h, scale});
-    reg.add_component(projectile,
-                      animation_component{projectile_frames, 0.2f, false});
-    reg.add_component(projectile, collision_box{collision_w, collision_h});
-    reg.add_component(projectile, damage_on_contact{damage, true});
-    reg.add_component(projectile, projectile_tag{});
-    reg.add_component(projectile, entity_tag{RType::EntityType::Projectile});
-    reg.add_component(projectile, enemy_tag{});
-
-    return projectile;
+    static const enemy_projectile_prefab shot = makeEnemyProjectile(
+        "assets/r-typesheet14-22.gif", {0, 0, 16, 14}, 2.5f,
+        {{48, 0, 16, 14}, {32, 0, 16, 14}, {16, 0, 16, 14}, {0, 0, 16, 14}}, 0.2f, false, 35.0f, 35.0f);
+    return shot.instantiate(reg, position{x, y}, velocity{vx, vy}, damage_on_contact{damage, true});
 }
 
 
 entity createFlyingEnemyProjectile(registry& reg, float x, float y, float vx, float vy, int damage) {
-    entity projectile = reg.spawn_entity();
-
-    reg.register_component<position>();
-    reg.register_component<velocity>();
-    reg.register_component<sprite_component>();
-    reg.register_component<animation_component>();
-    reg.register_component<collision_box>();
-    reg.register_component<damage_on_contact>();
-    reg.register_component<projectile_tag>();
-    reg.register_component<entity_tag>();
-    reg.register_component<enemy_tag>();
-
-    std::vector<sf::IntRect> projectile_frames = {
-        {0, 0, 32, 32},
-        {32, 0, 32, 32}
-    };
-    int texture_x = 0;
-    int texture_y = 0;
-    int texture_w = 32;
-    int texture_h = 32;
-    float scale = -2.5f;
-    float collision_w = 50.0f;
-    float collision_h = 50.0f;
-
-    reg.add_component(projectile, position{x, y});
-    reg.add_component(projectile, velocity{vx, vy});
-    reg.add_component(projectile,
-                      sprite_component{"assets/r-typesheet9-33.gif", texture_x, texture_y, texture_w, texture_h, scale});
-    reg.add_component(projectile,
-                      animation_component{projectile_frames, 0.15f, true});
-    reg.add_component(projectile, collision_box{collision_w, collision_h});
-    reg.add_component(projectile, damage_on_contact{damage, true});
-    reg.add_component(projectile, projectile_tag{});
-    reg.add_component(projectile, entity_tag{RType::EntityType::Projectile});
-    reg.add_component(projectile, enemy_tag{});
-
-    return projectile;
+    static const enemy_projectile_prefab shot = makeEnemyProjectile(
+        "assets/r-typesheet9-33.gif", {0, 0, 32, 32}, -2.5f, {{0, 0, 32, 32}, {32, 0, 32, 32}},
+        0.15f, true, 50.0f, 50.0f);
+    return shot.instantiate(reg, position{x, y}, velocity{vx, vy}, damage_on_contact{damage, true});
 }
 entity createEnemy4Projectile(registry& reg, float x, float y, float vx, float vy, int damage) {
-    entity projectile = reg.spawn_entity();
-
-    reg.register_component<position>();
-    reg.register_component<velocity>();
-    reg.register_component<sprite_component>();
-    reg.register_component<animation_component>();
-    reg.register_component<collision_box>();
-    reg.register_component<damage_on_contact>();
-    reg.register_component<projectile_tag>();
-    reg.register_component<entity_tag>();
-    reg.register_component<enemy_tag>();
-    reg.register_component<custom_entity_id>();
-
-    std::vector<sf::IntRect> projectile_frames = {
-        {0, 0, 65, 18},
-        {65, 0, 65, 18}
-    };
-    int texture_x = 0;
-    int texture_y = 0;
-    int texture_w = 65;
-    int texture_h = 18;
-    float scale = -3.5f;
-    float collision_w = 50.0f;
-    float collision_h = 40.0f;
-
-    reg.add_component(projectile, position{x, y});
-    reg.add_component(projectile, velocity{vx, vy});
-    reg.add_component(projectile,
-                      sprite_component{"assets/r-typesheet9-22.gif", texture_x, texture_y, texture_w, texture_h, scale});
-    reg.add_component(projectile,
-                      animation_component{projectile_frames, 0.2f, true});
-    reg.add_component(projectile, collision_box{collision_w, collision_h});
-    reg.add_component(projectile, damage_on_contact{damage, true});
-    reg.add_component(projectile, projectile_tag{});
-    reg.add_component(projectile, entity_tag{RType::EntityType::CustomProjectile});
-    reg.add_component(projectile, enemy_tag{});
-    reg.add_component(projectile, custom_entity_id{"assets/r-typesheet9-22.gif"});
+    static const enemy_projectile_prefab shot = makeEnemyProjectile(
+        "assets/r-typesheet9-22.gif", {0, 0, 65, 18}, -3.5f, {{0, 0, 65, 18}, {65, 0, 65, 18}},
+        0.2f, true, 50.0f, 40.0f, RType::EntityType::CustomProjectile);
+    static const custom_entity_id shot_id{"assets/r-typesheet9-22.gif"};
 
+    entity projectile = shot.instantiate(reg, position{x, y}, velocity{vx, vy}, damage_on_contact{damage, true});
+    reg.add_component(projectile, shot_id);
     return projectile;
 }
 
 entity createEnemy5Projectile(registry& reg, float x, float y, float vx, float vy, int damage) {
-    entity projectile = reg.spawn_entity();
-
-    reg.register_component<position>();
-    reg.register_component<velocity>();
-    reg.register_component<sprite_component>();
-    reg.register_component<animation_component>();
-    reg.register_component<collision_box>();
-    reg.register_component<damage_on_contact>();
-    reg.register_component<projectile_tag>();
-    reg.register_component<entity_tag>();
-    reg.register_component<enemy_tag>();
-
-    std::vector<sf::IntRect> projectile_frames = {
-        {0, 0, 30, 12},
-        {30, 0, 30, 12}
-    };
-    int texture_x = 0;
-    int texture_y = 0;
-    int texture_w = 30;
-    int texture_h = 12;
-    float scale = -3.0f;
-    float collision_w = 45.0f;
-    float collision_h = 20.0f;
-
-    reg.add_component(projectile, position{x, y});
-    reg.add_component(projectile, velocity{vx, vy});
-    reg.add_component(projectile,
-                      sprite_component{"assets/r-typesheet9-3.gif", texture_x, texture_y, texture_w, texture_h, scale});
-    reg.add_component(projectile,
-                      animation_component{projectile_frames, 0.1f, true});
-    reg.add_component(projectile, collision_box{collision_w, collision_h});
-    reg.add_component(projectile, damage_on_contact{damage, true});
-    reg.add_component(projectile, projectile_tag{});
-    reg.add_component(projectile, entity_tag{RType::EntityType::Projectile});
-    reg.add_component(projectile, enemy_tag{});
-
-    return projectile;
+    static const enemy_projectile_prefab shot = makeEnemyProjectile(
+        "assets/r-typesheet9-3.gif", {0, 0, 30, 12}, -3.0f, {{0, 0, 30, 12}, {30, 0, 30, 12}},
+        0.1f, true, 45.0f, 20.0f);
+    return shot.instantiate(reg, position{x, y}, velocity{vx, vy}, damage_on_contact{damage, true});
 }
 
 entity createExplosiveGrenade(registry& reg, float x, float y, float vx, float vy, 
                               float lifetime, float explosion_radius, int explosion_damage) {
-    entity grenade = reg.spawn_entity();
-
-    reg.register_component<position>();
-    reg.register_component<velocity>();
-    reg.register_component<sprite_component>();
-    reg.register_component<animation_component>();
-    reg.register_component<collision_box>();
-    reg.register_component<damage_on_contact>();
-    reg.register_component<projectile_tag>();
-    reg.register_component<entity_tag>();
-    reg.register_component<enemy_tag>();
-    reg.register_component<explosive_projectile>();
+    static const enemy_projectile_prefab grenade = makeEnemyProjectile(
+        "assets/r-typesheet16.gif", {0, 0, 32, 32}, 1.8f,
+        {{0, 0, 32, 32}, {33, 0, 32, 32}, {66, 0, 32, 32}, {33, 0, 32, 32}}, 0.15f, true, 40.0f, 40.0f);
 
-    std::vector<sf::IntRect> grenade_frames = {
-        {0, 0, 32, 32},
-        {33, 0, 32, 32},
-        {66, 0, 32, 32},
-        {33, 0, 32, 32}
-    };
-
-    int texture_x = 0;
-    int texture_y = 0;
-    int texture_w = 32;
-    int texture_h = 32;
-    float scale = 1.8f;
-    float collision_w = 40.0f;
-    float collision_h = 40.0f;
-
-    reg.add_component(grenade, position{x, y});
-    reg.add_component(grenade, velocity{vx, vy});
-    reg.add_component(grenade,
-                      sprite_component{"assets/r-typesheet16.gif", texture_x, texture_y, texture_w, texture_h, scale});
-    reg.add_component(grenade,
-                      animation_component{grenade_frames, 0.15f, true});
-    reg.add_component(grenade, collision_box{collision_w, collision_h});
-    reg.add_component(grenade, damage_on_contact{15, true});
-    reg.add_component(grenade, projectile_tag{});
-    reg.add_component(grenade, entity_tag{RType::EntityType::Projectile});
-    reg.add_component(grenade, enemy_tag{});
-    reg.add_component(grenade, explosive_projectile{lifetime, explosion_radius, explosion_damage});
+    entity projectile = grenade.instantiate(reg, position{x, y}, velocity{vx, vy}, damage_on_contact{15, true});
+    reg.add_component(projectile, explosive_projectile{lifetime, explosion_radius, explosion_damage});
+    return projectile;
+}
 
-    return grenade;
+void reserveEnemyProjectiles(registry& reg, std::size_t count) {
+    enemyShotPrefab().reserve(reg, count);
 }
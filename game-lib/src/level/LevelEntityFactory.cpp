@@ -1,6 +1,7 @@
 #include "level/LevelEntityFactory.hpp"
 #include "components/game_components.hpp"
 #include "ecs/components.hpp"
+#include "systems/movement_system.hpp"
 
 namespace rtype::level {
 
@@ -13,7 +14,7 @@ void LevelEntityFactory::setOnEntityCreated(EntityCreatedCallback callback) {
 
 void LevelEntityFactory::setupSpriteComponent(entity e, const SpriteConfig& config) {
     sprite_component sprite;
-    sprite.texture_path = config.texture_path;
+    sprite.set_texture(config.texture_path);
     sprite.texture_rect_x = 0;
     sprite.texture_rect_y = 0;
     sprite.texture_rect_w = config.frame_width;
@@ -43,8 +44,9 @@ void LevelEntityFactory::setupAnimationComponent(entity e, const SpriteConfig& c
 }
 
 void LevelEntityFactory::setupBehaviorComponent(entity e, const BehaviorConfig& config) {
-    (void)e;
-    (void)config;
+    if (auto pattern = makeMovementPattern(config.movement)) {
+        registry_.add_component(e, *pattern);
+    }
 }
 
 void LevelEntityFactory::setupAttackComponent(entity e, const AttackPatternConfig& config) {
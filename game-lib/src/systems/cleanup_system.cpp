@@ -3,11 +3,18 @@
 #include "components/game_components.hpp"
 #include "components/logic_components.hpp"
 #include "entities/explosion_factory.hpp"
+#include "systems/despawn_schedule.hpp"
 #include <vector>
 
 void cleanupSystem(registry& reg, float dt) {
+    engine::CommandBuffer commands;
+    cleanupSystem(reg, dt, commands);
+    commands.flush(reg);
+}
+
+void cleanupSystem(registry& reg, float dt, engine::CommandBuffer& commands) {
+    despawn_schedule& schedule = despawn_schedule_of(reg);
     auto& positions = reg.get_components<position>();
-    auto& healths = reg.get_components<health>();
     auto& enemy_tags = reg.get_components<enemy_tag>();
     auto& player_tags = reg.get_components<player_tag>();
     auto& serpent_parts = reg.get_components<serpent_part>();
@@ -15,91 +22,76 @@ void cleanupSystem(registry& reg, float dt) {
 
     std::vector<entity> entities_to_kill;
 
-    for (std::size_t i = 0; i < healths.size(); ++i) {
-        auto& health_opt = healths[i];
+    // Advanced first, so explosions spawned below count this tick as lived.
+    schedule.collect_expired(dt, entities_to_kill);
 
-        if (health_opt && health_opt.value().is_dead()) {
-            bool is_player = (i < player_tags.size() && player_tags[i]);
-            if (is_player) {
-                continue;
-            }
-            bool is_serpent_part = (i < serpent_parts.size() && serpent_parts[i].has_value());
-            if (is_serpent_part) {
-                continue;
-            }
-            bool is_compiler_part = false;
-            if (i < tags.size() && tags[i].has_value()) {
-                auto entity_type = tags[i]->type;
-                is_compiler_part = (entity_type == RType::EntityType::CompilerPart1 ||
-                                   entity_type == RType::EntityType::CompilerPart2 ||
-                                   entity_type == RType::EntityType::CompilerPart3);
-            }
-            if (is_compiler_part) {
-                continue;
-            }
-            bool is_boss = false;
-            if (i < tags.size() && tags[i].has_value()) {
-                auto entity_type = tags[i]->type;
-                is_boss = (entity_type == RType::EntityType::Boss);
-            }
-            if (is_boss) {
+    auto& healths = reg.get_components<health>();
+
+    // Only what a damage path flagged as killed; it may have been reaped or
+    // healed since.
+    for (entity const& dead : schedule.unique_deaths()) {
+        if (!reg.is_alive(dead)) {
+            continue;
+        }
+        std::size_t i = dead.id();
+        const health* hp = healths.find(i);
+        if (hp == nullptr || !hp->is_dead()) {
+            continue;
+        }
+        if (player_tags.contains(i) || serpent_parts.contains(i)) {
+            continue;
+        }
+        if (const entity_tag* tag = tags.find(i)) {
+            auto entity_type = tag->type;
+            bool is_compiler_part = (entity_type == RType::EntityType::CompilerPart1 ||
+                                     entity_type == RType::EntityType::CompilerPart2 ||
+                                     entity_type == RType::EntityType::CompilerPart3);
+            if (is_compiler_part || entity_type == RType::EntityType::Boss) {
                 continue;
             }
-            bool is_enemy = (i < enemy_tags.size() && enemy_tags[i]);
-            if (is_enemy && i < positions.size() && positions[i]) {
-                auto& pos = positions[i].value();
-                createExplosion(reg, pos.x, pos.y);
+        }
+        if (enemy_tags.contains(i)) {
+            if (const position* pos = positions.find(i)) {
+                createExplosion(commands, pos->x, pos->y);
             }
-            entities_to_kill.push_back(reg.entity_from_index(i));
         }
+        entities_to_kill.push_back(dead);
     }
+    schedule.clear_deaths();
 
     auto& projectile_tags = reg.get_components<projectile_tag>();
-    auto& explosion_tags = reg.get_components<explosion_tag>();
-
-    for (std::size_t i = 0; i < positions.size(); ++i) {
-        auto& pos_opt = positions[i];
-
-        if (pos_opt) {
-            auto& pos = pos_opt.value();
-            bool is_serpent_part = (i < serpent_parts.size() && serpent_parts[i].has_value());
-            if (is_serpent_part) {
-                continue;
-            }
 
-            bool is_projectile = (i < projectile_tags.size() && projectile_tags[i]);
-            bool is_enemy = (i < enemy_tags.size() && enemy_tags[i]);
-            
-            bool is_boss = false;
-            if (i < tags.size() && tags[i].has_value()) {
-                auto entity_type = tags[i]->type;
-                is_boss = (entity_type == RType::EntityType::Boss);
-            }
+    // Only what the movement stage saw leave the playfield; it may have been
+    // killed or moved back in since.
+    for (entity const& flagged : schedule.out_of_bounds()) {
+        if (!reg.is_alive(flagged)) {
+            continue;
+        }
+        std::size_t i = flagged.id();
+        const position* pos = positions.find(i);
+        if (pos == nullptr || serpent_parts.contains(i)) {
+            continue;
+        }
 
-            if (is_projectile && !is_boss) {
-                if (pos.x < 0.0f || pos.x > 1920.0f || pos.y < 0.0f || pos.y > 1080.0f) {
-                    entities_to_kill.push_back(reg.entity_from_index(i));
-                }
-            } else if (is_enemy && !is_boss) {
-                if (pos.x < 0.0f || pos.x > 2200.0f || pos.y < -200.0f || pos.y > 1300.0f) {
-                    entities_to_kill.push_back(reg.entity_from_index(i));
-                }
-            }
+        const entity_tag* tag = tags.find(i);
+        bool is_boss = (tag && tag->type == RType::EntityType::Boss);
+        if (is_boss) {
+            continue;
         }
-    }
 
-    for (std::size_t i = 0; i < explosion_tags.size(); ++i) {
-        auto& explosion_opt = explosion_tags[i];
-        if (explosion_opt) {
-            auto& explosion = explosion_opt.value();
-            explosion.elapsed += dt;
-            if (explosion.elapsed >= explosion.lifetime) {
-                entities_to_kill.push_back(reg.entity_from_index(i));
+        if (projectile_tags.contains(i)) {
+            if (!despawn_schedule::inside_projectile_bounds(*pos)) {
+                entities_to_kill.push_back(flagged);
+            }
+        } else if (enemy_tags.contains(i)) {
+            if (!despawn_schedule::inside_enemy_bounds(*pos)) {
+                entities_to_kill.push_back(flagged);
             }
         }
     }
+    schedule.clear_out_of_bounds();
 
     for (auto& ent : entities_to_kill) {
-        reg.kill_entity(ent);
+        commands.kill(ent);
     }
 }
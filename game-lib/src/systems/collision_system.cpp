@@ -1,704 +1,719 @@
 #include "systems/collision_system.hpp"
+#include "systems/collision_grid.hpp"
+#include "systems/collision_layer_resolver.hpp"
+#include "systems/despawn_schedule.hpp"
 #include "components/logic_components.hpp"
 #include "components/game_components.hpp"
 #include "entities/explosion_factory.hpp"
 #include "../../../src/Common/Opcodes.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
 #include <iostream>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Broadphase state, rebuilt every tick from position + collision_layer.
+ *
+ * Targets are bucketed into one grid per collision_layer category, so a pass
+ * only ever queries the categories in its driver's mask. The *_order lists hold
+ * the entities that drive a pass, in ascending index order.
+ *
+ * Moving entities are inserted with the bounds they swept over the tick, and
+ * contacts are resolved by time of impact (aabb::sweep_time), so a fast shot
+ * cannot tunnel through a thin target between two ticks. Contacts at the
+ * same time, including every contact of a tick without motion, go to the
+ * lowest entity index.
+ */
+struct collision_world {
+    struct motion {
+        float dx;
+        float dy;
+    };
+
+    std::array<collision_grid, collision_layer::category_count> grids;
+    std::vector<collision_layer> layers;  // Indexed by entity, empty for non-collidables
+    std::vector<aabb> boxes;              // End-of-tick box, indexed by entity
+    std::vector<motion> motions;          // Displacement over the tick, indexed by entity
+
+    std::vector<std::size_t> shot_order;     // Every projectile category
+    std::vector<std::size_t> homing_order;
+    std::vector<std::size_t> serpent_order;
+    std::vector<std::size_t> shield_order;
+    std::vector<std::size_t> enemy_order;  // Only filled while a shield is up
+    std::vector<std::size_t> boss_order;   // Only filled while a shield is up
+
+    // What detection has decided so far this tick, indexed by entity.
+    std::vector<std::uint8_t> removed;      // Consumed, killed or knocked out
+    std::vector<std::uint8_t> immune;       // Laser immunity granted this tick
+    std::vector<int> pending_damage;
+
+    collision_grid& grid(std::uint16_t category) {
+        return grids[static_cast<std::size_t>(std::countr_zero(category))];
+    }
 
-void collisionSystem(registry& reg) {
+    /**
+     * @brief Bounds @p idx swept over the tick, to query the grids with.
+     */
+    aabb sweep_bounds(std::size_t idx) const {
+        return boxes[idx].swept(motions[idx].dx, motions[idx].dy);
+    }
+
+    /**
+     * @brief When @p mover first touches @p target's end-of-tick box @p target_box
+     * during the tick, or a negative value if it does not.
+     */
+    float impact(std::size_t mover, std::size_t target, aabb const& target_box) const {
+        return boxes[mover].sweep_time(motions[mover].dx - motions[target].dx,
+                                       motions[mover].dy - motions[target].dy, target_box);
+    }
+
+    float impact(std::size_t mover, std::size_t target) const {
+        return impact(mover, target, boxes[target]);
+    }
+
+    /**
+     * @brief Earliest hit of @p mover in any grid of @p categories; @p accept filters candidates.
+     */
+    template <typename Filter>
+    std::size_t earliest_hit(std::uint16_t categories, std::size_t mover, Filter&& accept) const {
+        std::size_t best = collision_grid::npos;
+        float best_time = 0.0f;
+        const aabb bounds = sweep_bounds(mover);
+        for (std::size_t bit = 0; bit < grids.size(); ++bit) {
+            if ((categories & (1u << bit)) != 0) {
+                grids[bit].earliest_hit(
+                    bounds, [&](std::size_t idx) { return accept(idx) ? impact(mover, idx) : -1.0f; },
+                    best, best_time);
+            }
+        }
+        return best;
+    }
+};
+
+// Kept across ticks so rebuilding the grids does not allocate; per thread since
+// lobbies may tick on different threads.
+collision_world& scratch_world() {
+    thread_local collision_world world;
+    return world;
+}
+
+template <typename... Components>
+void collect_sorted(registry& reg, std::vector<std::size_t>& out) {
+    out.clear();
+    reg.view<Components...>().each([&](std::size_t idx, Components&...) { out.push_back(idx); });
+    std::sort(out.begin(), out.end());
+}
+
+void build_world(registry& reg, collision_world& world, float dt) {
     auto& positions = reg.get_components<position>();
+    auto& velocities = reg.get_components<velocity>();
     auto& collision_boxes = reg.get_components<collision_box>();
     auto& multi_hitboxes = reg.get_components<multi_hitbox>();
+    auto& healths = reg.get_components<health>();
     auto& damage_contacts = reg.get_components<damage_on_contact>();
+    const collision_layer_resolver resolve(reg);
+
+    for (auto& grid : world.grids) {
+        grid.clear();
+    }
+    world.layers.assign(positions.size(), collision_layer{});
+    world.boxes.resize(positions.size());
+    world.motions.resize(positions.size());
+    world.removed.assign(positions.size(), 0);
+    world.immune.assign(positions.size(), 0);
+    world.pending_damage.assign(positions.size(), 0);
+    world.shot_order.clear();
+    world.homing_order.clear();
+    world.serpent_order.clear();
+
+    constexpr std::uint16_t shots = collision_layer::player_shots | collision_layer::enemy_shots;
+
+    for (std::size_t idx = 0; idx < positions.size(); ++idx) {
+        const position* pos = positions.find(idx);
+        if (pos == nullptr) {
+            continue;
+        }
+        const collision_layer layer = resolve(idx);
+        if (layer.category == 0) {
+            continue;
+        }
+        world.layers[idx] = layer;
+
+        const collision_box* box = collision_boxes.find(idx);
+        const multi_hitbox* hitbox = multi_hitboxes.find(idx);
+        const bool alive = healths.contains(idx);
+        if (box != nullptr) {
+            world.boxes[idx] = aabb::from(*pos, *box);
+        } else if (hitbox != nullptr) {
+            world.boxes[idx] = aabb::bounds(*pos, *hitbox);
+        }
+        const velocity* vel = velocities.find(idx);
+        world.motions[idx] = vel != nullptr ? collision_world::motion{vel->vx * dt, vel->vy * dt}
+                                            : collision_world::motion{0.0f, 0.0f};
+        const aabb bounds = world.sweep_bounds(idx);
+
+        if (layer.is(shots)) {
+            if (box != nullptr) {
+                world.grid(layer.category & shots).insert(idx, bounds);
+                world.shot_order.push_back(idx);
+            }
+            continue;
+        }
+        if (layer.is(collision_layer::Player) && box != nullptr && alive) {
+            world.grid(collision_layer::Player).insert(idx, bounds);
+        }
+        if (layer.is(collision_layer::Enemy) && box != nullptr && box->enabled && alive) {
+            world.grid(collision_layer::Enemy).insert(idx, bounds);
+        }
+        if (layer.is(collision_layer::Boss) && alive) {
+            if (hitbox != nullptr) {
+                world.grid(collision_layer::Boss)
+                    .insert(idx, aabb::bounds(*pos, *hitbox).swept(world.motions[idx].dx, world.motions[idx].dy));
+            } else if (box != nullptr) {
+                world.grid(collision_layer::Boss).insert(idx, bounds);
+            }
+        }
+        if (layer.is(collision_layer::SerpentPart) && box != nullptr) {
+            world.grid(collision_layer::SerpentPart).insert(idx, bounds);
+            if (damage_contacts.contains(idx)) {
+                world.serpent_order.push_back(idx);
+            }
+        }
+        if (layer.is(collision_layer::Homing) && box != nullptr) {
+            if (alive) {
+                world.grid(collision_layer::Homing).insert(idx, bounds);
+            }
+            if (damage_contacts.contains(idx)) {
+                world.homing_order.push_back(idx);
+            }
+        }
+    }
+
+    for (auto& grid : world.grids) {
+        grid.build();
+    }
+
+    collect_sorted<player_tag, position, shield>(reg, world.shield_order);
+    world.enemy_order.clear();
+    world.boss_order.clear();
+}
+
+void credit_enemy_kill(sparse_array<level_manager>& level_managers) {
+    if (level_managers.dense_size() > 0) {
+        level_managers.dense_value(0).on_enemy_killed();
+    }
+}
+
+void credit_boss_kill(sparse_array<level_manager>& level_managers) {
+    if (level_managers.dense_size() == 0) {
+        return;
+    }
+    auto& lvl = level_managers.dense_value(0);
+    int remaining = lvl.enemies_needed_for_next_level - lvl.enemies_killed_this_level;
+    for (int m = 0; m < remaining; ++m) {
+        lvl.on_enemy_killed();
+    }
+}
+
+
+bool is_boss_part(const entity_tag* tag) {
+    return tag != nullptr && (tag->type == RType::EntityType::SerpentHoming ||
+                              tag->type == RType::EntityType::CompilerPart1 ||
+                              tag->type == RType::EntityType::CompilerPart2 ||
+                              tag->type == RType::EntityType::CompilerPart3);
+}
+
+/**
+ * @brief Damage stage: applies every contact to health, flashes and immunity,
+ * and appends a killed event for each target whose health reaches zero, which
+ * is also flagged in the despawn_schedule for cleanup.
+ *
+ * A target dies once per tick however many contacts it took; only the blow
+ * crossing zero emits the event.
+ */
+void apply_damage(registry& reg, collision_event_buffer& events) {
     auto& healths = reg.get_components<health>();
-    auto& enemy_tags = reg.get_components<enemy_tag>();
-    auto& boss_tags = reg.get_components<boss_tag>();
-    auto& projectile_tags = reg.get_components<projectile_tag>();
-    auto& player_tags = reg.get_components<player_tag>();
-    auto& level_managers = reg.get_components<level_manager>();
-    auto& shields = reg.get_components<shield>();
     auto& damage_flashes = reg.get_components<damage_flash_component>();
-    auto& homing_comps = reg.get_components<homing_component>();
-    auto& sprite_components = reg.get_components<sprite_component>();
-    auto& serpent_parts = reg.get_components<serpent_part>();
     auto& serpent_controllers = reg.get_components<serpent_boss_controller>();
-    auto& entity_tags = reg.get_components<entity_tag>();
+    auto& laser_immunities = reg.get_components<laser_damage_immunity>();
+    despawn_schedule& schedule = despawn_schedule_of(reg);
 
-    for (std::size_t p = 0; p < positions.size() && p < player_tags.size(); ++p) {
-        if (player_tags[p] && positions[p] && shields[p]) {
-            if (p < collision_boxes.size() && collision_boxes[p].has_value() && !collision_boxes[p]->enabled) {
-                continue;
+    auto flash = [&](std::size_t idx) {
+        if (damage_flash_component* f = damage_flashes.find(idx)) {
+            f->trigger();
+        }
+    };
+
+    const std::size_t contacts = events.size();
+    for (std::size_t k = 0; k < contacts; ++k) {
+        const collision_event ev = events[k];  // Copied: the buffer grows below
+        auto killed = [&](int before, int after) {
+            if (before > 0 && after <= 0) {
+                schedule.flag_death(reg.entity_from_index(ev.target));
+                events.push_back({collision_event::kind::killed, ev.type, 0, ev.target_category,
+                                  ev.source, ev.target, ev.amount});
             }
-            auto& player_pos = positions[p].value();
-            auto& player_shield = shields[p].value();
-
-            if (player_shield.is_active()) {
-                for (std::size_t e = 0; e < positions.size() && e < enemy_tags.size(); ++e) {
-                    if (enemy_tags[e] && positions[e] && healths[e]) {
-                        auto& enemy_pos = positions[e].value();
-                        auto& enemy_hp = healths[e].value();
-
-                        if (player_shield.is_enemy_in_range(enemy_pos.x, enemy_pos.y, player_pos.x, player_pos.y)) {
-                            enemy_hp.current = 0;
-
-                            createExplosion(reg, enemy_pos.x, enemy_pos.y);
-
-                            bool is_serpent_homing = (e < entity_tags.size() && entity_tags[e].has_value() &&
-                                                      entity_tags[e]->type == RType::EntityType::SerpentHoming);
-                            if (!is_serpent_homing) {
-                                for (size_t k = 0; k < level_managers.size(); ++k) {
-                                    if (level_managers[k].has_value()) {
-                                        level_managers[k]->on_enemy_killed();
-                                        break;
-                                    }
-                                }
-                            }
-
-                            auto enemy_entity = reg.entity_from_index(e);
-                            reg.remove_component<entity_tag>(enemy_entity);
-                            reg.kill_entity(enemy_entity);
-                        }
-                    }
-                }
+        };
 
-                for (std::size_t b = 0; b < positions.size() && b < boss_tags.size(); ++b) {
-                    if (boss_tags[b] && positions[b] && healths[b]) {
-                        auto& boss_pos = positions[b].value();
-                        auto& boss_hp = healths[b].value();
-
-                        if (player_shield.is_enemy_in_range(boss_pos.x, boss_pos.y, player_pos.x, player_pos.y)) {
-                            boss_hp.current -= 10;
-                            if (boss_hp.current < 0) boss_hp.current = 0;
-
-                            if (b < damage_flashes.size() && damage_flashes[b].has_value()) {
-                                damage_flashes[b]->trigger();
-                            }
-
-                            createExplosion(reg, boss_pos.x + (player_pos.x - boss_pos.x) * 0.3f, 
-                                          boss_pos.y + (player_pos.y - boss_pos.y) * 0.3f);
-
-                            if (boss_hp.is_dead()) {
-                                createExplosion(reg, boss_pos.x, boss_pos.y);
-
-                                for (size_t k = 0; k < level_managers.size(); ++k) {
-                                    if (level_managers[k].has_value()) {
-                                        auto& lvl = level_managers[k].value();
-                                        int remaining = lvl.enemies_needed_for_next_level - lvl.enemies_killed_this_level;
-                                        for (int m = 0; m < remaining; ++m) {
-                                            lvl.on_enemy_killed();
-                                        }
-                                        break;
-                                    }
-                                }
-
-                                auto boss_entity = reg.entity_from_index(b);
-                                reg.remove_component<entity_tag>(boss_entity);
-                                reg.kill_entity(boss_entity);
-                            }
-                        }
-                    }
+        switch (ev.type) {
+        case collision_event::kind::shot_hit: {
+            if (ev.target_category == collision_layer::SerpentPart) {
+                if (serpent_controllers.dense_size() > 0) {
+                    serpent_controllers.dense_value(0).take_global_damage(ev.amount);
                 }
+                flash(ev.target);
+                break;
+            }
+            auto& hp = healths[ev.target].value();
+            const int before = hp.current;
+            hp.current = std::max(0, hp.current - ev.amount);
+            if (ev.target_category != collision_layer::Homing) {
+                flash(ev.target);
             }
+            killed(before, hp.current);
+            break;
         }
-    }
-
-    for (std::size_t i = 0; i < positions.size() && i < projectile_tags.size(); ++i) {
-        if (projectile_tags[i] && positions[i] && collision_boxes[i] && damage_contacts[i]) {
-            bool is_enemy_projectile = (i < enemy_tags.size() && enemy_tags[i].has_value());
-
-            if (is_enemy_projectile) continue;
-
-            auto& proj_pos = positions[i].value();
-            auto& proj_box = collision_boxes[i].value();
-            auto& proj_dmg = damage_contacts[i].value();
-
-            bool projectile_consumed = false;
-
-            for (std::size_t j = 0; j < positions.size() && j < enemy_tags.size(); ++j) {
-                if (i == j) continue;
-                if (projectile_consumed) break;
-
-                if (j < projectile_tags.size() && projectile_tags[j].has_value()) continue;
-                if (j < serpent_parts.size() && serpent_parts[j].has_value()) continue;
-
-                if (enemy_tags[j] && positions[j] && collision_boxes[j] && healths[j]) {
-                    auto& enemy_pos = positions[j].value();
-                    auto& enemy_box = collision_boxes[j].value();
-                    auto& enemy_hp = healths[j].value();
-                    if (!enemy_box.enabled) continue;
-
-                    float p_left = proj_pos.x + proj_box.offset_x;
-                    float p_top = proj_pos.y + proj_box.offset_y;
-                    float p_right = p_left + proj_box.width;
-                    float p_bottom = p_top + proj_box.height;
-
-                    float e_left = enemy_pos.x + enemy_box.offset_x;
-                    float e_top = enemy_pos.y + enemy_box.offset_y;
-                    float e_right = e_left + enemy_box.width;
-                    float e_bottom = e_top + enemy_box.height;
-
-                    if (p_left < e_right && p_right > e_left &&
-                        p_top < e_bottom && p_bottom > e_top) {
-                        if (j < entity_tags.size() && entity_tags[j].has_value()) {
-                            auto ent_type = static_cast<int>(entity_tags[j]->type);
-                            if (ent_type == 0x1C || ent_type == 0x1D || ent_type == 0x1E) {
-                                std::cout << "[COLLISION] Hit Compiler Part type=" << std::hex << ent_type 
-                                         << " HP before=" << enemy_hp.current << " damage=" << proj_dmg.damage_amount << std::endl;
-                            }
-                        }
-                        enemy_hp.current -= proj_dmg.damage_amount;
-                        if (enemy_hp.current < 0) enemy_hp.current = 0;
-
-                        if (j < damage_flashes.size() && damage_flashes[j].has_value()) {
-                            damage_flashes[j]->trigger();
-                        }
-
-                        if (proj_dmg.destroy_on_hit) {
-                            auto proj_entity = reg.entity_from_index(i);
-                            reg.remove_component<entity_tag>(proj_entity);
-                            reg.kill_entity(proj_entity);
-                            projectile_consumed = true;
-                        }
-
-                        if (enemy_hp.is_dead()) {
-                            createExplosion(reg, enemy_pos.x, enemy_pos.y);
-
-                            bool is_boss_part = (j < entity_tags.size() && entity_tags[j].has_value() &&
-                                                (entity_tags[j]->type == RType::EntityType::SerpentHoming ||
-                                                 entity_tags[j]->type == RType::EntityType::CompilerPart1 ||
-                                                 entity_tags[j]->type == RType::EntityType::CompilerPart2 ||
-                                                 entity_tags[j]->type == RType::EntityType::CompilerPart3));
-                            if (!is_boss_part) {
-                                for (size_t k = 0; k < level_managers.size(); ++k) {
-                                    if (level_managers[k].has_value()) {
-                                        level_managers[k]->on_enemy_killed();
-                                        break;
-                                    }
-                                }
-                            }
-                        }
-                        break;
-                    }
-                }
+        case collision_event::kind::shots_cancelled:
+            if (health* hp = healths.find(ev.target)) {
+                const int before = hp->current;
+                hp->current -= ev.amount;
+                killed(before, hp->current);
+            } else {
+                killed(1, 0);
             }
-            if (projectile_consumed) continue;
-
-            for (std::size_t j = 0; j < positions.size() && j < boss_tags.size(); ++j) {
-                if (i == j) continue;
-
-                if (j < projectile_tags.size() && projectile_tags[j].has_value()) continue;
-
-                if (boss_tags[j] && positions[j] && healths[j]) {
-                    auto& boss_pos = positions[j].value();
-                    auto& boss_hp = healths[j].value();
-
-                    float p_left = proj_pos.x + proj_box.offset_x;
-                    float p_top = proj_pos.y + proj_box.offset_y;
-                    float p_right = p_left + proj_box.width;
-                    float p_bottom = p_top + proj_box.height;
-
-                    bool hit_detected = false;
-
-                    if (j < multi_hitboxes.size() && multi_hitboxes[j].has_value()) {
-                        auto& boss_multi = multi_hitboxes[j].value();
-                        for (const auto& part : boss_multi.parts) {
-                            float b_left = boss_pos.x + part.offset_x;
-                            float b_top = boss_pos.y + part.offset_y;
-                            float b_right = b_left + part.width;
-                            float b_bottom = b_top + part.height;
-
-                            if (p_left < b_right && p_right > b_left &&
-                                p_top < b_bottom && p_bottom > b_top) {
-                                hit_detected = true;
-                                break;
-                            }
-                        }
-                    } else if (j < collision_boxes.size() && collision_boxes[j].has_value()) {
-                        auto& boss_box = collision_boxes[j].value();
-                        float b_left = boss_pos.x + boss_box.offset_x;
-                        float b_top = boss_pos.y + boss_box.offset_y;
-                        float b_right = b_left + boss_box.width;
-                        float b_bottom = b_top + boss_box.height;
-
-                        if (p_left < b_right && p_right > b_left &&
-                            p_top < b_bottom && p_bottom > b_top) {
-                            hit_detected = true;
-                        }
-                    }
-
-                    if (hit_detected) {
-                        boss_hp.current -= proj_dmg.damage_amount;
-                        if (boss_hp.current < 0) boss_hp.current = 0;
-
-                        if (j < damage_flashes.size() && damage_flashes[j].has_value()) {
-                            damage_flashes[j]->trigger();
-                        }
-
-                        createExplosion(reg, proj_pos.x, proj_pos.y);
-
-                        if (proj_dmg.destroy_on_hit) {
-                            auto proj_entity = reg.entity_from_index(i);
-                            reg.remove_component<entity_tag>(proj_entity);
-                            reg.kill_entity(proj_entity);
-                            projectile_consumed = true;
-                        }
-
-                        if (boss_hp.is_dead()) {
-                            createExplosion(reg, boss_pos.x, boss_pos.y);
-
-                            for (size_t k = 0; k < level_managers.size(); ++k) {
-                                if (level_managers[k].has_value()) {
-                                    auto& lvl = level_managers[k].value();
-                                    int remaining = lvl.enemies_needed_for_next_level - lvl.enemies_killed_this_level;
-                                    for (int m = 0; m < remaining; ++m) {
-                                        lvl.on_enemy_killed();
-                                    }
-                                    break;
-                                }
-                            }
-                        }
-                        break;
-                    }
-                }
+            break;
+        case collision_event::kind::player_hit: {
+            if (ev.has(collision_event::shielded)) {
+                break;
             }
-            if (projectile_consumed) continue;
-
-            for (std::size_t j = 0; j < positions.size() && j < serpent_parts.size(); ++j) {
-                if (i == j) continue;
-
-                if (j < projectile_tags.size() && projectile_tags[j].has_value()) continue;
-
-                if (serpent_parts[j].has_value() && positions[j].has_value() &&
-                    j < collision_boxes.size() && collision_boxes[j].has_value()) {
-                    auto& part_pos = positions[j].value();
-                    auto& part_box = collision_boxes[j].value();
-
-                    float p_left = proj_pos.x + proj_box.offset_x;
-                    float p_top = proj_pos.y + proj_box.offset_y;
-                    float p_right = p_left + proj_box.width;
-                    float p_bottom = p_top + proj_box.height;
-
-                    float s_left = part_pos.x + part_box.offset_x;
-                    float s_top = part_pos.y + part_box.offset_y;
-                    float s_right = s_left + part_box.width;
-                    float s_bottom = s_top + part_box.height;
-
-                    if (p_left < s_right && p_right > s_left &&
-                        p_top < s_bottom && p_bottom > s_top) {
-                        for (std::size_t c = 0; c < serpent_controllers.size(); ++c) {
-                            if (serpent_controllers[c].has_value()) {
-                                serpent_controllers[c].value().take_global_damage(proj_dmg.damage_amount);
-                                break;
-                            }
-                        }
-                        if (j < damage_flashes.size() && damage_flashes[j].has_value()) {
-                            damage_flashes[j]->trigger();
-                        }
-
-                        createExplosion(reg, proj_pos.x, proj_pos.y);
-
-                        if (proj_dmg.destroy_on_hit) {
-                            auto proj_entity = reg.entity_from_index(i);
-                            reg.remove_component<entity_tag>(proj_entity);
-                            reg.kill_entity(proj_entity);
-                            projectile_consumed = true;
-                        }
-                        break;
-                    }
+            if (ev.has(collision_event::laser)) {
+                if (laser_damage_immunity* immunity = laser_immunities.find(ev.target)) {
+                    immunity->trigger();
                 }
             }
-            if (projectile_consumed) continue;
-
-            for (std::size_t j = 0; j < positions.size() && j < homing_comps.size(); ++j) {
-                if (i == j) continue;
-
-                if (j < projectile_tags.size() && projectile_tags[j].has_value()) continue;
-
-                if (homing_comps[j] && positions[j] && collision_boxes[j] && healths[j]) {
-                    auto& homing_pos = positions[j].value();
-                    auto& homing_box = collision_boxes[j].value();
-                    auto& homing_hp = healths[j].value();
-
-                    float p_left = proj_pos.x + proj_box.offset_x;
-                    float p_top = proj_pos.y + proj_box.offset_y;
-                    float p_right = p_left + proj_box.width;
-                    float p_bottom = p_top + proj_box.height;
-
-                    float h_left = homing_pos.x + homing_box.offset_x;
-                    float h_top = homing_pos.y + homing_box.offset_y;
-                    float h_right = h_left + homing_box.width;
-                    float h_bottom = h_top + homing_box.height;
-
-                    if (p_left < h_right && p_right > h_left &&
-                        p_top < h_bottom && p_bottom > h_top) {
-                        homing_hp.current -= proj_dmg.damage_amount;
-                        if (homing_hp.current < 0) homing_hp.current = 0;
-
-                        if (proj_dmg.destroy_on_hit) {
-                            auto proj_entity = reg.entity_from_index(i);
-                            reg.remove_component<entity_tag>(proj_entity);
-                            reg.kill_entity(proj_entity);
-                        }
-
-                        if (homing_hp.is_dead()) {
-                            createExplosion(reg, homing_pos.x, homing_pos.y);
-                            auto homing_entity = reg.entity_from_index(j);
-                            reg.remove_component<entity_tag>(homing_entity);
-                            reg.kill_entity(homing_entity);
-                        }
-                        break;
-                    }
-                }
+            auto& hp = healths[ev.target].value();
+            const int before = hp.current;
+            hp.current = std::max(0, hp.current - ev.amount);
+            killed(before, hp.current);
+            break;
+        }
+        case collision_event::kind::shield_hit: {
+            auto& hp = healths[ev.target].value();
+            if (ev.target_category == collision_layer::Enemy) {
+                // The shield destroys enemies outright, even ones already at zero.
+                hp.current = 0;
+                killed(1, 0);
+                break;
             }
+            const int before = hp.current;
+            hp.current = std::max(0, hp.current - ev.amount);
+            flash(ev.target);
+            killed(before, hp.current);
+            break;
+        }
+        case collision_event::kind::killed:
+            break;
         }
     }
+}
 
-    for (std::size_t i = 0; i < positions.size() && i < projectile_tags.size(); ++i) {
-        if (projectile_tags[i] && positions[i] && collision_boxes[i]) {
-            bool is_enemy_projectile_i = (i < enemy_tags.size() && enemy_tags[i].has_value());
-
-            auto& proj_pos_i = positions[i].value();
-            auto& proj_box_i = collision_boxes[i].value();
-
-            for (std::size_t j = i + 1; j < positions.size() && j < projectile_tags.size(); ++j) {
-                if (projectile_tags[j] && positions[j] && collision_boxes[j]) {
-                    bool is_enemy_projectile_j = (j < enemy_tags.size() && enemy_tags[j].has_value());
-
-                    if (is_enemy_projectile_i != is_enemy_projectile_j) {
-                        std::size_t enemy_idx = is_enemy_projectile_i ? i : j;
-                        bool is_boss_projectile = false;
-                        if (enemy_idx < entity_tags.size() && entity_tags[enemy_idx].has_value()) {
-                            auto type = entity_tags[enemy_idx]->type;
-                            is_boss_projectile = (type == static_cast<RType::EntityType>(0x07));
-                        }
-                        if (is_boss_projectile) {
-                            continue;
-                        }
-                        auto& proj_pos_j = positions[j].value();
-                        auto& proj_box_j = collision_boxes[j].value();
-
-                        float pi_left = proj_pos_i.x + proj_box_i.offset_x;
-                        float pi_top = proj_pos_i.y + proj_box_i.offset_y;
-                        float pi_right = pi_left + proj_box_i.width;
-                        float pi_bottom = pi_top + proj_box_i.height;
-
-                        float pj_left = proj_pos_j.x + proj_box_j.offset_x;
-                        float pj_top = proj_pos_j.y + proj_box_j.offset_y;
-                        float pj_right = pj_left + proj_box_j.width;
-                        float pj_bottom = pj_top + proj_box_j.height;
-
-                        if (pi_left < pj_right && pi_right > pj_left &&
-                            pi_top < pj_bottom && pi_bottom > pj_top) {
-
-                            std::size_t player_proj_idx = is_enemy_projectile_i ? j : i;
-
-                            auto proj_entity_player = reg.entity_from_index(player_proj_idx);
-                            reg.remove_component<entity_tag>(proj_entity_player);
-                            reg.kill_entity(proj_entity_player);
-
-                            if (enemy_idx < healths.size() && healths[enemy_idx].has_value()) {
-                                auto& enemy_hp = healths[enemy_idx].value();
-                                enemy_hp.current -= 1;
-                                if (enemy_hp.current <= 0) {
-                                    auto proj_entity_enemy = reg.entity_from_index(enemy_idx);
-                                    reg.remove_component<entity_tag>(proj_entity_enemy);
-                                    reg.kill_entity(proj_entity_enemy);
-                                }
-                            } else {
-                                auto proj_entity_enemy = reg.entity_from_index(enemy_idx);
-                                reg.remove_component<entity_tag>(proj_entity_enemy);
-                                reg.kill_entity(proj_entity_enemy);
-                            }
-
-                        break;
-                    }
-                }
+/**
+ * @brief Explosion stage: impact sparks on bosses and serpent parts, and one
+ * explosion per death.
+ */
+void spawn_explosions(registry& reg, collision_event_buffer const& events,
+                      engine::CommandBuffer& commands) {
+    auto& positions = reg.get_components<position>();
+    constexpr std::uint16_t explodes_on_death = collision_layer::Enemy | collision_layer::Boss |
+                                                collision_layer::Homing | collision_layer::Player;
+
+    for (auto const& ev : events) {
+        switch (ev.type) {
+        case collision_event::kind::shot_hit:
+            if (ev.target_category == collision_layer::Boss ||
+                ev.target_category == collision_layer::SerpentPart) {
+                auto& impact = positions[ev.source].value();
+                createExplosion(commands, impact.x, impact.y);
             }
+            break;
+        case collision_event::kind::shield_hit:
+            if (ev.target_category == collision_layer::Boss) {
+                auto& boss_pos = positions[ev.target].value();
+                auto& player_pos = positions[ev.source].value();
+                createExplosion(commands, boss_pos.x + (player_pos.x - boss_pos.x) * 0.3f,
+                                boss_pos.y + (player_pos.y - boss_pos.y) * 0.3f);
+            }
+            break;
+        case collision_event::kind::killed:
+            if ((ev.target_category & explodes_on_death) != 0) {
+                auto& target_pos = positions[ev.target].value();
+                createExplosion(commands, target_pos.x, target_pos.y);
+            }
+            break;
+        default:
+            break;
         }
     }
-    }
+}
 
-    for (std::size_t h = 0; h < positions.size() && h < homing_comps.size(); ++h) {
-        if (homing_comps[h] && positions[h] && collision_boxes[h] && damage_contacts[h]) {
-            auto& homing_pos = positions[h].value();
-            auto& homing_box = collision_boxes[h].value();
-            auto& homing_dmg = damage_contacts[h].value();
-
-            for (std::size_t j = 0; j < positions.size() && j < player_tags.size(); ++j) {
-                if (h == j) continue;
-
-                if (player_tags[j] && positions[j] && collision_boxes[j] && healths[j]) {
-                    auto& player_pos = positions[j].value();
-                    auto& player_box = collision_boxes[j].value();
-                    auto& player_hp = healths[j].value();
-                    if (!player_box.enabled) {
-                        continue;
-                    }
+/**
+ * @brief Scoring stage: credits the level for every enemy and boss killed.
+ */
+void credit_kills(registry& reg, collision_event_buffer const& events) {
+    auto& level_managers = reg.get_components<level_manager>();
+    auto& entity_tags = reg.get_components<entity_tag>();
 
-                    float h_left = homing_pos.x + homing_box.offset_x;
-                    float h_top = homing_pos.y + homing_box.offset_y;
-                    float h_right = h_left + homing_box.width;
-                    float h_bottom = h_top + homing_box.height;
-
-                    float pl_left = player_pos.x + player_box.offset_x;
-                    float pl_top = player_pos.y + player_box.offset_y;
-                    float pl_right = pl_left + player_box.width;
-                    float pl_bottom = pl_top + player_box.height;
-
-                    if (h_left < pl_right && h_right > pl_left &&
-                        h_top < pl_bottom && h_bottom > pl_top) {
-
-                        bool has_active_shield = false;
-                        if (j < shields.size() && shields[j].has_value()) {
-                            has_active_shield = shields[j]->is_active();
-                        }
-
-                        if (!has_active_shield) {
-                            player_hp.current -= homing_dmg.damage_amount;
-                            if (player_hp.current < 0) player_hp.current = 0;
-
-                            if (player_hp.is_dead()) {
-                                createExplosion(reg, player_pos.x, player_pos.y);
-                                if (j < sprite_components.size() && sprite_components[j].has_value()) {
-                                    sprite_components[j]->visible = false;
-                                }
-                                if (j < collision_boxes.size() && collision_boxes[j].has_value()) {
-                                    collision_boxes[j]->enabled = false;
-                                }
-                            }
-                        }
-
-                        if (homing_dmg.destroy_on_hit) {
-                            auto homing_entity = reg.entity_from_index(h);
-                            reg.remove_component<entity_tag>(homing_entity);
-                            reg.kill_entity(homing_entity);
-                        }
-
-                        break;
-                    }
-                }
-            }
+    for (auto const& ev : events) {
+        if (ev.type != collision_event::kind::killed) {
+            continue;
+        }
+        if (ev.target_category == collision_layer::Enemy && !is_boss_part(entity_tags.find(ev.target))) {
+            credit_enemy_kill(level_managers);
+        } else if (ev.target_category == collision_layer::Boss) {
+            credit_boss_kill(level_managers);
         }
     }
+}
 
-    auto& laser_immunities = reg.get_components<laser_damage_immunity>();
-
-    for (std::size_t s = 0; s < positions.size() && s < serpent_parts.size(); ++s) {
-        if (serpent_parts[s].has_value() && positions[s].has_value() &&
-            s < collision_boxes.size() && collision_boxes[s].has_value() &&
-            s < damage_contacts.size() && damage_contacts[s].has_value()) {
-            auto& part_pos = positions[s].value();
-            auto& part_box = collision_boxes[s].value();
-            auto& part_dmg = damage_contacts[s].value();
-            for (std::size_t p = 0; p < positions.size() && p < player_tags.size(); ++p) {
-                if (s == p) continue;
-                if (player_tags[p].has_value() && positions[p].has_value() &&
-                    p < collision_boxes.size() && collision_boxes[p].has_value() &&
-                    p < healths.size() && healths[p].has_value()) {
-                    auto& player_pos = positions[p].value();
-                    auto& player_box = collision_boxes[p].value();
-                    auto& player_hp = healths[p].value();
-                    if (!player_box.enabled) continue;
-                    float s_left = part_pos.x + part_box.offset_x;
-                    float s_top = part_pos.y + part_box.offset_y;
-                    float s_right = s_left + part_box.width;
-                    float s_bottom = s_top + part_box.height;
-                    float p_left = player_pos.x + player_box.offset_x;
-                    float p_top = player_pos.y + player_box.offset_y;
-                    float p_right = p_left + player_box.width;
-                    float p_bottom = p_top + player_box.height;
-                    if (s_left < p_right && s_right > p_left &&
-                        s_top < p_bottom && s_bottom > p_top) {
-                        bool has_active_shield = false;
-                        if (p < shields.size() && shields[p].has_value()) {
-                            has_active_shield = shields[p]->is_active();
-                        }
-                        if (!has_active_shield) {
-                            if (p < laser_immunities.size() && laser_immunities[p].has_value()) {
-                                if (laser_immunities[p]->is_immune()) {
-                                    continue;
-                                }
-                                laser_immunities[p]->trigger();
-                            }
-                            player_hp.current -= part_dmg.damage_amount;
-                            if (player_hp.current < 0) player_hp.current = 0;
-                            if (player_hp.is_dead()) {
-                                createExplosion(reg, player_pos.x, player_pos.y);
-                                if (p < sprite_components.size() && sprite_components[p].has_value()) {
-                                    sprite_components[p]->visible = false;
-                                }
-                                if (p < collision_boxes.size() && collision_boxes[p].has_value()) {
-                                    collision_boxes[p]->enabled = false;
-                                }
-                            }
-                        }
-                        break;
-                    }
+/**
+ * @brief Kill stage: destroys consumed shots and what the collision killed
+ * outright, and knocks out dead players. Enemies and bosses shot down are
+ * left to the cleanup system, as before.
+ */
+void apply_kills(registry& reg, collision_event_buffer const& events, engine::CommandBuffer& commands) {
+    auto& collision_boxes = reg.get_components<collision_box>();
+    auto& sprite_components = reg.get_components<sprite_component>();
+    const collision_layer_resolver resolve(reg);
+
+    for (auto const& ev : events) {
+        switch (ev.type) {
+        case collision_event::kind::shot_hit:
+        case collision_event::kind::player_hit:
+        case collision_event::kind::shots_cancelled:
+            if (ev.has(collision_event::source_consumed)) {
+                commands.kill(reg.entity_from_index(ev.source));
+            }
+            break;
+        case collision_event::kind::killed:
+            if (ev.target_category == collision_layer::Player) {
+                std::cout << (resolve(ev.source).is(collision_layer::player_shots)
+                                  ? "[Collision] Player killed by friendly fire!"
+                                  : "[Collision] Player killed!")
+                          << std::endl;
+                if (sprite_component* sprite = sprite_components.find(ev.target)) {
+                    sprite->visible = false;
                 }
+                if (collision_box* box = collision_boxes.find(ev.target)) {
+                    box->enabled = false;
+                }
+            } else if (ev.cause == collision_event::kind::shield_hit ||
+                       ev.cause == collision_event::kind::shots_cancelled ||
+                       ev.target_category == collision_layer::Homing) {
+                commands.kill(reg.entity_from_index(ev.target));
             }
+            break;
+        default:
+            break;
         }
     }
+}
 
-    for (std::size_t i = 0; i < positions.size() && i < projectile_tags.size(); ++i) {
-        if (projectile_tags[i] && positions[i] && collision_boxes[i] && damage_contacts[i]) {
-            bool is_enemy_projectile = (i < enemy_tags.size() && enemy_tags[i].has_value());
-
-            if (!is_enemy_projectile) continue;
+}  // namespace
 
-            auto& proj_pos = positions[i].value();
-            auto& proj_box = collision_boxes[i].value();
-            auto& proj_dmg = damage_contacts[i].value();
-            bool is_laser = false;
-            if (i < entity_tags.size() && entity_tags[i].has_value()) {
-                auto type = entity_tags[i]->type;
-                is_laser = (type == RType::EntityType::SerpentLaser ||
-                           type == static_cast<RType::EntityType>(0x17));
-            }
+void detect_collisions(registry& reg, collision_event_buffer& events, float dt) {
+    auto& positions = reg.get_components<position>();
+    auto& collision_boxes = reg.get_components<collision_box>();
+    auto& multi_hitboxes = reg.get_components<multi_hitbox>();
+    auto& damage_contacts = reg.get_components<damage_on_contact>();
+    auto& healths = reg.get_components<health>();
+    auto& shields = reg.get_components<shield>();
+    auto& entity_tags = reg.get_components<entity_tag>();
+    auto& laser_immunities = reg.get_components<laser_damage_immunity>();
 
-            for (std::size_t j = 0; j < positions.size() && j < player_tags.size(); ++j) {
-                if (i == j) continue;
+    events.clear();
+    collision_world& world = scratch_world();
+    build_world(reg, world, dt);
+
+    using kind = collision_event::kind;
+    auto emit = [&](kind type, std::uint8_t flags, std::uint16_t category, std::size_t source,
+                    std::size_t target, int amount) {
+        events.push_back({type, type, flags, category, static_cast<std::uint32_t>(source),
+                          static_cast<std::uint32_t>(target), amount});
+    };
+
+    auto removed = [&](std::size_t idx) { return world.removed[idx] != 0; };
+
+    // Books @p amount against the target's health; true once that is fatal.
+    auto deal = [&](std::size_t idx, int amount) {
+        world.pending_damage[idx] += amount;
+        return healths[idx]->current - world.pending_damage[idx] <= 0;
+    };
+
+    auto shield_active = [&](std::size_t idx) {
+        const shield* s = shields.find(idx);
+        return s != nullptr && s->is_active();
+    };
+
+    auto player_down = [&](std::size_t idx) {
+        return removed(idx) || !collision_boxes[idx]->enabled;
+    };
+
+    auto laser_immune = [&](std::size_t idx) {
+        const laser_damage_immunity* immunity = laser_immunities.find(idx);
+        return immunity != nullptr && (immunity->is_immune() || world.immune[idx] != 0);
+    };
+
+    for (std::size_t p : world.shield_order) {
+        if (const collision_box* box = collision_boxes.find(p); box != nullptr && !box->enabled) {
+            continue;
+        }
+        auto& player_shield = shields[p].value();
+        if (!player_shield.is_active()) {
+            continue;
+        }
+        const position player_pos = positions[p].value();
 
-                if (player_tags[j] && positions[j] && collision_boxes[j] && healths[j]) {
-                    auto& player_pos = positions[j].value();
-                    auto& player_box = collision_boxes[j].value();
-                    auto& player_hp = healths[j].value();
-                    if (!player_box.enabled) {
-                        continue;
-                    }
+        if (world.enemy_order.empty() && world.boss_order.empty()) {
+            collect_sorted<enemy_tag, position, health>(reg, world.enemy_order);
+            collect_sorted<boss_tag, position, health>(reg, world.boss_order);
+        }
 
-                    float p_left = proj_pos.x + proj_box.offset_x;
-                    float p_top = proj_pos.y + proj_box.offset_y;
-                    float p_right = p_left + proj_box.width;
-                    float p_bottom = p_top + proj_box.height;
-
-                    float pl_left = player_pos.x + player_box.offset_x;
-                    float pl_top = player_pos.y + player_box.offset_y;
-                    float pl_right = pl_left + player_box.width;
-                    float pl_bottom = pl_top + player_box.height;
-
-                    if (p_left < pl_right && p_right > pl_left &&
-                        p_top < pl_bottom && p_bottom > pl_top) {
-
-                        bool has_active_shield = false;
-                        if (j < shields.size() && shields[j].has_value()) {
-                            has_active_shield = shields[j]->is_active();
-                        }
-
-                        if (!has_active_shield) {
-                            if (is_laser && j < laser_immunities.size() && laser_immunities[j].has_value()) {
-                                if (laser_immunities[j]->is_immune()) {
-                                    continue;
-                                }
-                                laser_immunities[j]->trigger();
-                            }
-                            player_hp.current -= proj_dmg.damage_amount;
-                            if (player_hp.current < 0) player_hp.current = 0;
-
-                            if (player_hp.is_dead()) {
-                                std::cout << "[Collision] Player killed!" << std::endl;
-                                createExplosion(reg, player_pos.x, player_pos.y);
-                                if (j < sprite_components.size() && sprite_components[j].has_value()) {
-                                    sprite_components[j]->visible = false;
-                                }
-                                if (j < collision_boxes.size() && collision_boxes[j].has_value()) {
-                                    collision_boxes[j]->enabled = false;
-                                }
-                            }
-                        }
-
-                        if (proj_dmg.destroy_on_hit) {
-                            auto proj_entity = reg.entity_from_index(i);
-                            reg.remove_component<entity_tag>(proj_entity);
-                            reg.kill_entity(proj_entity);
-                        }
-
-                        break;
-                    }
-                }
+        for (std::size_t e : world.enemy_order) {
+            auto& enemy_pos = positions[e].value();
+            if (removed(e) ||
+                !player_shield.is_enemy_in_range(enemy_pos.x, enemy_pos.y, player_pos.x, player_pos.y)) {
+                continue;
             }
+            emit(kind::shield_hit, 0, collision_layer::Enemy, p, e, healths[e]->current);
+            world.removed[e] = 1;
         }
 
-    auto& game_settings_comps = reg.get_components<game_settings>();
-    bool friendly_fire_enabled = false;
-    for (const auto& settings_opt : game_settings_comps) {
-        if (settings_opt.has_value()) {
-            friendly_fire_enabled = settings_opt->friendly_fire_enabled;
-            break;
+        for (std::size_t b : world.boss_order) {
+            auto& boss_pos = positions[b].value();
+            if (removed(b) ||
+                !player_shield.is_enemy_in_range(boss_pos.x, boss_pos.y, player_pos.x, player_pos.y)) {
+                continue;
+            }
+            emit(kind::shield_hit, 0, collision_layer::Boss, p, b, 10);
+            if (deal(b, 10)) {
+                world.removed[b] = 1;
+            }
         }
     }
 
-    if (friendly_fire_enabled) {
-        auto& ally_projectile_tags = reg.get_components<ally_projectile_tag>();
-
-        for (std::size_t ff_i = 0; ff_i < positions.size() && ff_i < projectile_tags.size(); ++ff_i) {
-            if (!projectile_tags[ff_i] || !positions[ff_i] || !collision_boxes[ff_i] || !damage_contacts[ff_i]) continue;
+    // Player shots against enemies, bosses, serpent parts and homing missiles.
+    // A shot that survives a hit (destroy_on_hit unset) goes on to the next kind.
+    for (std::size_t i : world.shot_order) {
+        const collision_layer layer = world.layers[i];
+        if (!layer.tests(collision_layer::shootable) || !damage_contacts.contains(i) || removed(i)) {
+            continue;
+        }
 
-            bool is_player_projectile = !(ff_i < enemy_tags.size() && enemy_tags[ff_i].has_value());
-            if (!is_player_projectile) continue;
+        auto& proj_dmg = damage_contacts[i].value();
+        const std::uint8_t consumes = proj_dmg.destroy_on_hit ? collision_event::source_consumed : 0;
 
-            if (ff_i < ally_projectile_tags.size() && ally_projectile_tags[ff_i].has_value()) {
-                continue;
+        auto hit = [&](std::uint16_t category, std::size_t j, bool tracks_health) {
+            emit(kind::shot_hit, consumes, category, i, j, proj_dmg.damage_amount);
+            if (tracks_health && deal(j, proj_dmg.damage_amount)) {
+                world.removed[j] = 1;
+            }
+            if (consumes != 0) {
+                world.removed[i] = 1;
             }
+            return consumes != 0;
+        };
+
+        std::size_t j = collision_grid::npos;
+        if (layer.tests(collision_layer::Enemy)) {
+            j = world.earliest_hit(collision_layer::Enemy, i, [&](std::size_t idx) {
+                return idx != i && !removed(idx);
+            });
+        }
+        if (j != collision_grid::npos && hit(collision_layer::Enemy, j, true)) {
+            continue;
+        }
 
-            auto& proj_pos = positions[ff_i].value();
-            auto& proj_box = collision_boxes[ff_i].value();
-            auto& proj_dmg = damage_contacts[ff_i].value();
+        j = collision_grid::npos;
+        if (layer.tests(collision_layer::Boss)) {
+            // Multi-part bosses are hit when the shot reaches any of their parts.
+            auto boss_impact = [&](std::size_t idx) {
+                if (idx == i || removed(idx)) {
+                    return -1.0f;
+                }
+                const multi_hitbox* hitbox = multi_hitboxes.find(idx);
+                if (hitbox == nullptr) {
+                    return world.impact(i, idx);
+                }
+                auto& boss_pos = positions[idx].value();
+                float earliest = -1.0f;
+                for (auto const& part : hitbox->parts) {
+                    float t = world.impact(i, idx, aabb::from(boss_pos, part));
+                    if (t >= 0.0f && (earliest < 0.0f || t < earliest)) {
+                        earliest = t;
+                    }
+                }
+                return earliest;
+            };
+            j = world.grid(collision_layer::Boss).earliest_hit(world.sweep_bounds(i), boss_impact);
+        }
+        if (j != collision_grid::npos && hit(collision_layer::Boss, j, true)) {
+            continue;
+        }
 
-            for (std::size_t ff_j = 0; ff_j < positions.size() && ff_j < player_tags.size(); ++ff_j) {
-                if (!player_tags[ff_j] || !positions[ff_j] || !collision_boxes[ff_j] || !healths[ff_j]) continue;
+        j = collision_grid::npos;
+        if (layer.tests(collision_layer::SerpentPart)) {
+            j = world.earliest_hit(collision_layer::SerpentPart, i, [&](std::size_t idx) {
+                return idx != i;
+            });
+        }
+        if (j != collision_grid::npos && hit(collision_layer::SerpentPart, j, false)) {
+            continue;
+        }
 
-                auto& player_pos = positions[ff_j].value();
-                auto& player_box = collision_boxes[ff_j].value();
-                auto& player_hp = healths[ff_j].value();
+        j = collision_grid::npos;
+        if (layer.tests(collision_layer::Homing)) {
+            j = world.earliest_hit(collision_layer::Homing, i, [&](std::size_t idx) {
+                return idx != i && !removed(idx);
+            });
+        }
+        if (j != collision_grid::npos) {
+            hit(collision_layer::Homing, j, true);
+        }
+    }
 
-                float p_left = proj_pos.x + proj_box.offset_x;
-                float p_top = proj_pos.y + proj_box.offset_y;
-                float p_right = p_left + proj_box.width;
-                float p_bottom = p_top + proj_box.height;
+    // Shots cancel each other out when one's mask holds the other's category;
+    // boss shots are masked out, so they pass through.
+    constexpr std::uint16_t shots = collision_layer::player_shots | collision_layer::enemy_shots;
+    for (std::size_t i : world.shot_order) {
+        const std::uint16_t targets = world.layers[i].mask & shots;
+        if (targets == 0 || removed(i)) {
+            continue;
+        }
+        std::size_t j = world.earliest_hit(targets, i, [&](std::size_t idx) {
+            return idx > i && !removed(idx);
+        });
+        if (j == collision_grid::npos) {
+            continue;
+        }
 
-                float pl_left = player_pos.x + player_box.offset_x;
-                float pl_top = player_pos.y + player_box.offset_y;
-                float pl_right = pl_left + player_box.width;
-                float pl_bottom = pl_top + player_box.height;
+        const bool is_enemy_shot_i = world.layers[i].is(collision_layer::enemy_shots);
+        std::size_t enemy_shot = is_enemy_shot_i ? i : j;
+        std::size_t player_shot = is_enemy_shot_i ? j : i;
 
-                if (p_left < pl_right && p_right > pl_left &&
-                    p_top < pl_bottom && p_bottom > pl_top) {
+        emit(kind::shots_cancelled, collision_event::source_consumed,
+             world.layers[enemy_shot].category & collision_layer::enemy_shots, player_shot, enemy_shot, 1);
+        world.removed[player_shot] = 1;
+        if (!healths.contains(enemy_shot) || deal(enemy_shot, 1)) {
+            world.removed[enemy_shot] = 1;
+        }
+    }
 
-                    bool has_active_shield = false;
-                    if (ff_j < shields.size() && shields[ff_j].has_value()) {
-                        has_active_shield = shields[ff_j]->is_active();
-                    }
+    // Books a contact on player @p p; shields absorb the damage but not the shot.
+    auto hit_player = [&](std::size_t source, std::size_t p, int amount, bool consumed, bool laser) {
+        const bool shielded = shield_active(p);
+        std::uint8_t flags = (consumed ? collision_event::source_consumed : 0) |
+                             (shielded ? collision_event::shielded : 0) |
+                             (laser ? collision_event::laser : 0);
+        emit(kind::player_hit, flags, collision_layer::Player, source, p, amount);
+        if (!shielded) {
+            if (laser) {
+                world.immune[p] = 1;
+            }
+            if (deal(p, amount)) {
+                world.removed[p] = 1;
+            }
+        }
+        if (consumed) {
+            world.removed[source] = 1;
+        }
+    };
 
-                    if (!has_active_shield) {
-                        player_hp.current -= proj_dmg.damage_amount;
-                        if (player_hp.current < 0) player_hp.current = 0;
+    for (std::size_t h : world.homing_order) {
+        if (!world.layers[h].tests(collision_layer::Player) || removed(h)) {
+            continue;
+        }
+        auto& homing_dmg = damage_contacts[h].value();
+        std::size_t j = world.earliest_hit(collision_layer::Player, h, [&](std::size_t idx) {
+            return idx != h && !player_down(idx);
+        });
+        if (j != collision_grid::npos) {
+            hit_player(h, j, homing_dmg.damage_amount, homing_dmg.destroy_on_hit, false);
+        }
+    }
 
-                        std::cout << "[Collision] Friendly fire! Player hit by ally projectile for " 
-                                  << proj_dmg.damage_amount << " damage" << std::endl;
+    for (std::size_t s : world.serpent_order) {
+        if (!world.layers[s].tests(collision_layer::Player)) {
+            continue;
+        }
+        auto& part_dmg = damage_contacts[s].value();
+
+        // Immune players let the part through to the next one, as if not touched.
+        std::size_t p = world.earliest_hit(collision_layer::Player, s, [&](std::size_t idx) {
+            return idx != s && !player_down(idx) && (shield_active(idx) || !laser_immune(idx));
+        });
+        if (p == collision_grid::npos || shield_active(p)) {
+            continue;
+        }
+        hit_player(s, p, part_dmg.damage_amount, false, true);
+    }
 
-                        if (player_hp.is_dead()) {
-                            std::cout << "[Collision] Player killed by friendly fire!" << std::endl;
-                            createExplosion(reg, player_pos.x, player_pos.y);
+    // Friendly fire only flips the player bit into the player shots' mask.
+    std::uint16_t friendly_fire_mask = 0;
+    auto& settings = reg.get_components<game_settings>();
+    if (settings.dense_size() > 0 && settings.dense_value(0).friendly_fire_enabled) {
+        friendly_fire_mask = collision_layer::Player;
+    }
 
-                            if (ff_j < sprite_components.size() && sprite_components[ff_j].has_value()) {
-                                sprite_components[ff_j]->visible = false;
-                            }
-                            if (ff_j < collision_boxes.size() && collision_boxes[ff_j].has_value()) {
-                                collision_boxes[ff_j]->enabled = false;
-                            }
-                        }
-                    }
+    for (std::size_t i : world.shot_order) {
+        const collision_layer layer = world.layers[i];
+        const std::uint16_t mask =
+            layer.is(collision_layer::PlayerProjectile) ? layer.mask | friendly_fire_mask : layer.mask;
+        if ((mask & collision_layer::Player) == 0 || !damage_contacts.contains(i) || removed(i)) {
+            continue;
+        }
 
-                    if (proj_dmg.destroy_on_hit) {
-                        auto proj_entity = reg.entity_from_index(ff_i);
-                        reg.remove_component<entity_tag>(proj_entity);
-                        reg.kill_entity(proj_entity);
-                    }
+        auto& proj_dmg = damage_contacts[i].value();
+        bool is_laser = false;
+        if (const entity_tag* tag = entity_tags.find(i)) {
+            is_laser = (tag->type == RType::EntityType::SerpentLaser ||
+                        tag->type == RType::EntityType::SerpentLaserSegment);
+        }
 
-                    break;
-                }
+        std::size_t j = world.earliest_hit(collision_layer::Player, i, [&](std::size_t idx) {
+            if (idx == i || player_down(idx)) {
+                return false;
             }
+            return !is_laser || shield_active(idx) || !laser_immune(idx);
+        });
+        if (j != collision_grid::npos) {
+            hit_player(i, j, proj_dmg.damage_amount, proj_dmg.destroy_on_hit, is_laser);
         }
     }
 }
+
+void resolve_collisions(registry& reg, collision_event_buffer& events, engine::CommandBuffer& commands) {
+    apply_damage(reg, events);
+    spawn_explosions(reg, events, commands);
+    credit_kills(reg, events);
+    apply_kills(reg, events, commands);
+}
+
+void collisionSystem(registry& reg, engine::CommandBuffer& commands, collision_event_buffer& events, float dt) {
+    detect_collisions(reg, events, dt);
+    resolve_collisions(reg, events, commands);
+}
+
+void collisionSystem(registry& reg, engine::CommandBuffer& commands) {
+    thread_local collision_event_buffer events;
+    collisionSystem(reg, commands, events);
+}
+
+void collisionSystem(registry& reg) {
+    engine::CommandBuffer commands;
+    collisionSystem(reg, commands);
+    commands.flush(reg);
 }
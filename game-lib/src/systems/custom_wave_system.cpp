@@ -1,4 +1,5 @@
 #include "systems/custom_wave_system.hpp"
+#include "systems/movement_system.hpp"
 #include "components/game_components.hpp"
 #include "ecs/components.hpp"
 #include <random>
@@ -78,7 +79,7 @@ void spawnCustomEnemy(registry& reg, const rtype::level::EnemyConfig& enemy_def,
     reg.add_component(enemy, weapon{fire_rate, proj_speed, proj_damage});
 
     sprite_component sprite;
-    sprite.texture_path = enemy_def.sprite.texture_path;
+    sprite.set_texture(enemy_def.sprite.texture_path);
     sprite.texture_rect_x = 0;
     sprite.texture_rect_y = 0;
     sprite.texture_rect_w = enemy_def.sprite.frame_width;
@@ -109,9 +110,12 @@ void spawnCustomEnemy(registry& reg, const rtype::level::EnemyConfig& enemy_def,
     reg.add_component(enemy, entity_tag{RType::EntityType::CustomEnemy});
 
     reg.add_component(enemy, custom_entity_id{enemy_def.id});
+    if (auto pattern = makeMovementPattern(enemy_def.behavior.movement)) {
+        reg.add_component(enemy, *pattern);
+    }
 
     custom_attack_config attack_cfg;
-    attack_cfg.pattern_type = enemy_def.attack.type;
+    attack_cfg.pattern_type = custom_attack_config::parse_pattern(enemy_def.attack.type);
     attack_cfg.projectile_count = enemy_def.attack.projectile_count;
     attack_cfg.spread_angle = enemy_def.attack.spread_angle;
     attack_cfg.aim_at_player = enemy_def.attack.aim_at_player;
@@ -155,7 +159,7 @@ void spawnCustomBoss(registry& reg, const rtype::level::EnemyConfig& boss_def, c
     reg.add_component(boss, weapon{fire_rate, proj_speed, proj_damage});
 
     sprite_component sprite;
-    sprite.texture_path = boss_def.sprite.texture_path;
+    sprite.set_texture(boss_def.sprite.texture_path);
     sprite.texture_rect_x = 0;
     sprite.texture_rect_y = 0;
     sprite.texture_rect_w = boss_def.sprite.frame_width;
@@ -187,9 +191,12 @@ void spawnCustomBoss(registry& reg, const rtype::level::EnemyConfig& boss_def, c
     reg.add_component(boss, boss_tag{});
 
     reg.add_component(boss, custom_entity_id{boss_def.id});
+    if (auto pattern = makeMovementPattern(boss_def.behavior.movement)) {
+        reg.add_component(boss, *pattern);
+    }
 
     custom_attack_config attack_cfg;
-    attack_cfg.pattern_type = boss_def.attack.type;
+    attack_cfg.pattern_type = custom_attack_config::parse_pattern(boss_def.attack.type);
     attack_cfg.projectile_count = boss_def.attack.projectile_count;
     attack_cfg.spread_angle = boss_def.attack.spread_angle;
     attack_cfg.aim_at_player = boss_def.attack.aim_at_player;
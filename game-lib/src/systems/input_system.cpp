@@ -4,21 +4,8 @@
 #include <SFML/Window/Keyboard.hpp>
 
 void inputSystem(registry& reg) {
-    auto& velocities = reg.get_components<velocity>();
-    auto& controllables = reg.get_components<controllable>();
-    auto& player_tags = reg.get_components<player_tag>();
-
-    for (std::size_t i = 0; i < velocities.size() && i < controllables.size() &&
-                            i < player_tags.size();
-         ++i) {
-        auto& vel_opt = velocities[i];
-        auto& ctrl_opt = controllables[i];
-        auto& player_opt = player_tags[i];
-
-        if (vel_opt && ctrl_opt && player_opt) {
-            auto& vel = vel_opt.value();
-            auto& ctrl = ctrl_opt.value();
-
+    reg.view<velocity, controllable, player_tag>().each(
+        [](std::size_t, velocity& vel, controllable& ctrl, player_tag&) {
             vel.vx = 0.0f;
             vel.vy = 0.0f;
 
@@ -38,6 +25,5 @@ void inputSystem(registry& reg) {
                 sf::Keyboard::isKeyPressed(sf::Keyboard::S)) {
                 vel.vy = ctrl.speed;
             }
-        }
-    }
+        });
 }
@@ -1,63 +1,72 @@
 #include "systems/movement_system.hpp"
 #include "ecs/components.hpp"
 #include "components/game_components.hpp"
+#include "systems/despawn_schedule.hpp"
 #include <cmath>
+#include <numbers>
 
-void movementSystem(registry& reg, float dt) {
+void movementSystem(registry& reg, float dt, movement_state& state) {
     auto& positions = reg.get_components<position>();
     auto& velocities = reg.get_components<velocity>();
-    auto& entity_tags = reg.get_components<entity_tag>();
-
-    static float wave_time = 0.0f;
-    wave_time += dt;
-    static float zigzag_timer = 0.0f;
-    zigzag_timer += dt;
-
-    for (std::size_t i = 0; i < positions.size() && i < velocities.size(); ++i) {
-        auto& pos_opt = positions[i];
-        auto& vel_opt = velocities[i];
-
-        if (pos_opt && vel_opt) {
-            auto& pos = pos_opt.value();
-            auto& vel = vel_opt.value();
-
-            if (i < entity_tags.size() && entity_tags[i].has_value() &&
-                entity_tags[i]->type == RType::EntityType::Enemy4) {
-                pos.x += vel.vx * dt;
-                pos.y += std::sin(wave_time * 3.0f + pos.x * 0.01f) * 100.0f * dt;
-            }
-            else if (i < entity_tags.size() && entity_tags[i].has_value() &&
-                     entity_tags[i]->type == RType::EntityType::FlyingEnemy) {
-                pos.x += vel.vx * dt;
-                float oscillation = std::sin(wave_time * 4.0f + static_cast<float>(i) * 0.3f) * 80.0f * dt;
-                pos.y += oscillation;
-            }
-            else if (i < entity_tags.size() && entity_tags[i].has_value() &&
-                     entity_tags[i]->type == RType::EntityType::Enemy5) {
-                pos.x += vel.vx * dt;
-                float zigzag_phase = std::fmod(zigzag_timer + static_cast<float>(i) * 0.5f, 2.0f);
-                float zigzag_direction = (zigzag_phase < 1.0f) ? 1.0f : -1.0f;
-                pos.y += zigzag_direction * 150.0f * dt;
-            } else {
-                pos.x += vel.vx * dt;
-                pos.y += vel.vy * dt;
-            }
-        }
+    auto& patterns = reg.get_components<movement_pattern>();
+
+    state.elapsed += dt;
+    const float t = state.elapsed;
+
+    for (auto& bucket : state.buckets) {
+        bucket.clear();
+    }
+    reg.view<movement_pattern, position, velocity>().each(
+        [&](std::size_t i, movement_pattern& pattern, position&, velocity&) {
+            state.buckets[static_cast<std::size_t>(pattern.type)].push_back(i);
+        });
+
+    // The sine phase follows the x the entity is about to move to.
+    for (std::size_t i : state.buckets[static_cast<std::size_t>(movement_pattern::kind::sine)]) {
+        const movement_pattern& pattern = *patterns[i];
+        velocity& vel = *velocities[i];
+        const float x = positions[i]->x + vel.vx * dt;
+        vel.vy = pattern.amplitude * std::sin(pattern.frequency * t + pattern.phase + pattern.phase_per_x * x);
     }
 
-    auto& bounds = reg.get_components<bounded_movement>();
-    for (std::size_t i = 0; i < positions.size() && i < bounds.size(); ++i) {
-        auto& pos_opt = positions[i];
-        auto& bound_opt = bounds[i];
+    for (std::size_t i : state.buckets[static_cast<std::size_t>(movement_pattern::kind::zigzag)]) {
+        const movement_pattern& pattern = *patterns[i];
+        const float leg = std::fmod(pattern.frequency * t + pattern.phase, 2.0f);
+        velocities[i]->vy = leg < 1.0f ? pattern.amplitude : -pattern.amplitude;
+    }
 
-        if (pos_opt && bound_opt) {
-            auto& pos = pos_opt.value();
-            auto& bound = bound_opt.value();
+    reg.parallel_each<position, velocity>([dt](std::size_t, position& pos, velocity& vel) {
+        pos.x += vel.vx * dt;
+        pos.y += vel.vy * dt;
+    });
 
+    reg.parallel_each<position, bounded_movement>(
+        [](std::size_t, position& pos, bounded_movement& bound) {
             if (pos.x < bound.min_x) pos.x = bound.min_x;
             if (pos.x > bound.max_x) pos.x = bound.max_x;
             if (pos.y < bound.min_y) pos.y = bound.min_y;
             if (pos.y > bound.max_y) pos.y = bound.max_y;
+        });
+
+    // Out-of-bounds checks ride on the movement stage: only movers can leave
+    // the playfield, and cleanupSystem then looks at just the flagged ones.
+    despawn_schedule& despawns = despawn_schedule_of(reg);
+    reg.view<position, velocity>().each([&](std::size_t i, position& pos, velocity&) {
+        if (!despawn_schedule::inside_projectile_bounds(pos)) {
+            despawns.flag_out_of_bounds(reg.entity_from_index(i));
         }
+    });
+}
+
+std::optional<movement_pattern> makeMovementPattern(const rtype::level::MovementPatternConfig& config) {
+    if (config.type == "sine" || config.type == "sine_wave") {
+        // y = amplitude * sin(w * t + phase), so vy = amplitude * w * cos(w * t + phase).
+        return movement_pattern::sine(config.amplitude * config.frequency, config.frequency,
+                                      config.phase + std::numbers::pi_v<float> / 2.0f);
+    }
+    if (config.type == "zigzag") {
+        // Each leg lasts 1 / frequency seconds and covers amplitude pixels.
+        return movement_pattern::zigzag(config.amplitude * config.frequency, config.frequency, config.phase);
     }
+    return std::nullopt;
 }
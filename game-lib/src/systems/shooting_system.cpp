@@ -4,69 +4,49 @@
 #include "entities/projectile_factory.hpp"
 #include <cmath>
 
-void shootingSystem(registry& reg, float dt) {
-    auto& weapons = reg.get_components<weapon>();
-
-    for (std::size_t i = 0; i < weapons.size(); ++i) {
-        auto& weapon_opt = weapons[i];
+namespace {
 
-        if (weapon_opt) {
-            auto& wpn = weapon_opt.value();
-            wpn.update(dt);
-        }
-    }
+// Projectiles are spawned when the system's command buffer is flushed, so the
+// loop below never resizes the pools it is iterating.
+template <typename Factory, typename... Args>
+void deferSpawn(engine::CommandBuffer& commands, Factory factory, Args... args) {
+    commands.defer([factory, args...](registry& reg) { factory(reg, args...); });
 }
 
-void enemyShootingSystem(registry& reg, float /*dt*/) {
-    auto& enemies = reg.get_components<enemy_tag>();
-    auto& weapons = reg.get_components<weapon>();
-    auto& positions = reg.get_components<position>();
-    auto& entity_tags = reg.get_components<entity_tag>();
-    auto& player_tags = reg.get_components<player_tag>();
-    auto& custom_attacks = reg.get_components<custom_attack_config>();
+}  // namespace
+
+void shootingSystem(registry& reg, float dt) {
+    reg.view<weapon>().each([dt](std::size_t, weapon& wpn) { wpn.update(dt); });
+}
 
-    for (std::size_t i = 0; i < enemies.size(); ++i) {
-        if (!enemies[i].has_value()) continue;
+void enemyShootingSystem(registry& reg, float dt, enemy_shooting_state& state) {
+    engine::CommandBuffer commands;
+    enemyShootingSystem(reg, dt, commands, state);
+    commands.flush(reg);
+}
 
-        if (i >= weapons.size() || !weapons[i].has_value()) continue;
-        if (i >= positions.size() || !positions[i].has_value()) continue;
-        if (i >= entity_tags.size() || !entity_tags[i].has_value()) continue;
+void enemyShootingSystem(registry& reg, float dt, engine::CommandBuffer& commands,
+                         enemy_shooting_state& state) {
+    player_targets players;
+    players.refresh(reg);
+    enemyShootingSystem(reg, dt, commands, players, state);
+}
 
-        auto& wpn = weapons[i].value();
-        auto& pos = positions[i].value();
-        auto& entity_tag = entity_tags[i].value();
+void enemyShootingSystem(registry& reg, float /*dt*/, engine::CommandBuffer& commands,
+                         const player_targets& players, enemy_shooting_state& state) {
+    auto& custom_attacks = reg.get_components<custom_attack_config>();
 
+    reg.view<enemy_tag, weapon, position, entity_tag>().each([&](std::size_t i, enemy_tag&,
+                                                                 weapon& wpn, position& pos,
+                                                                 entity_tag& entity_tag) {
         if (wpn.can_shoot()) {
-            bool has_custom_attack = (i < custom_attacks.size() && custom_attacks[i].has_value());
-            
-            if (has_custom_attack) {
-                const auto& attack = custom_attacks[i].value();
+            if (const custom_attack_config* attack_cfg = custom_attacks.find(i)) {
+                const auto& attack = *attack_cfg;
                 
-                if (attack.pattern_type == "targeted") {
-                    float nearest_dist = -1.0f;
-                    float target_x = -1.0f;
-                    float target_y = -1.0f;
-                    bool found_valid_target = false;
-
-                    for (std::size_t j = 0; j < player_tags.size(); ++j) {
-                        if (player_tags[j].has_value() && j < positions.size() && positions[j].has_value()) {
-                            const auto& player_pos = positions[j].value();
-                            float dx = player_pos.x - pos.x;
-                            float dy = player_pos.y - pos.y;
-                            float dist = std::sqrt(dx * dx + dy * dy);
-
-                            if (nearest_dist < 0.0f || dist < nearest_dist) {
-                                nearest_dist = dist;
-                                target_x = player_pos.x;
-                                target_y = player_pos.y;
-                                found_valid_target = true;
-                            }
-                        }
-                    }
-
-                    if (found_valid_target) {
-                        float dx = target_x - pos.x;
-                        float dy = target_y - pos.y;
+                if (attack.pattern_type == custom_attack_config::pattern::targeted) {
+                    if (const player_targets::target* target = players.nearest(pos.x, pos.y)) {
+                        float dx = target->x - pos.x;
+                        float dy = target->y - pos.y;
                         
                         float angle = std::atan2(dy, dx);
                         
@@ -83,9 +63,9 @@ void enemyShootingSystem(registry& reg, float /*dt*/) {
                         
                         float vx = std::cos(angle) * wpn.projectile_speed;
                         float vy = std::sin(angle) * wpn.projectile_speed;
-                        createCustomProjectile(reg, pos.x - 20.0f, pos.y, vx, vy, wpn.damage, attack);
+                        deferSpawn(commands, createCustomProjectile, pos.x - 20.0f, pos.y, vx, vy, wpn.damage, attack);
                     }
-                } else if (attack.pattern_type == "spread") {
+                } else if (attack.pattern_type == custom_attack_config::pattern::spread) {
                     float base_angle = -180.0f;
                     int count = attack.projectile_count;
                     float spread = attack.spread_angle;
@@ -98,39 +78,19 @@ void enemyShootingSystem(registry& reg, float /*dt*/) {
                         float angle_rad = (base_angle + angle_offset) * 3.14159f / 180.0f;
                         float vx = std::cos(angle_rad) * wpn.projectile_speed;
                         float vy = std::sin(angle_rad) * wpn.projectile_speed;
-                        createCustomProjectile(reg, pos.x - 20.0f, pos.y, vx, vy, wpn.damage, attack);
+                        deferSpawn(commands, createCustomProjectile, pos.x - 20.0f, pos.y, vx, vy, wpn.damage, attack);
                     }
                 } else {
-                    createCustomProjectile(reg, pos.x - 20.0f, pos.y, -wpn.projectile_speed, 0.0f, wpn.damage, attack);
+                    deferSpawn(commands, createCustomProjectile, pos.x - 20.0f, pos.y, -wpn.projectile_speed, 0.0f, wpn.damage, attack);
                 }
             } else if (entity_tag.type == RType::EntityType::Enemy2) {
-                float nearest_dist = -1.0f;
-                float target_x = -1.0f;
-                float target_y = -1.0f;
-                bool found_valid_target = false;
-
-                for (std::size_t j = 0; j < player_tags.size(); ++j) {
-                    if (player_tags[j].has_value() && j < positions.size() && positions[j].has_value()) {
-                        const auto& player_pos = positions[j].value();
-                        float dx = player_pos.x - pos.x;
-                        float dy = player_pos.y - pos.y;
-
-                        if (dx < 0.0f || std::abs(dx) < 100.0f) {
-                            float dist = std::sqrt(dx * dx + dy * dy);
-
-                            if (nearest_dist < 0.0f || dist < nearest_dist) {
-                                nearest_dist = dist;
-                                target_x = player_pos.x;
-                                target_y = player_pos.y;
-                                found_valid_target = true;
-                            }
-                        }
-                    }
-                }
+                // Players in front, or close enough behind.
+                const player_targets::target* target = players.nearest(
+                    pos.x, pos.y, [](float dx, float) { return dx < 0.0f || std::abs(dx) < 100.0f; });
 
-                if (found_valid_target) {
-                    float dx = target_x - pos.x;
-                    float dy = target_y - pos.y;
+                if (target != nullptr) {
+                    float dx = target->x - pos.x;
+                    float dy = target->y - pos.y;
                     
                     float angle = std::atan2(dy, dx);
                     
@@ -147,36 +107,15 @@ void enemyShootingSystem(registry& reg, float /*dt*/) {
                     
                     float vx = std::cos(angle) * wpn.projectile_speed * 1.5f;
                     float vy = std::sin(angle) * wpn.projectile_speed * 1.5f;
-                    createEnemy2Projectile(reg, pos.x - 20.0f, pos.y, vx, vy, wpn.damage);
+                    deferSpawn(commands, createEnemy2Projectile, pos.x - 20.0f, pos.y, vx, vy, wpn.damage);
                 }
             } else if (entity_tag.type == RType::EntityType::Enemy3) {
-                float nearest_dist = -1.0f;
-                float target_x = -1.0f;
-                float target_y = -1.0f;
-                bool found_valid_target = false;
-
-                for (std::size_t j = 0; j < player_tags.size(); ++j) {
-                    if (player_tags[j].has_value() && j < positions.size() && positions[j].has_value()) {
-                        const auto& player_pos = positions[j].value();
-                        float dx = player_pos.x - pos.x;
-                        float dy = player_pos.y - pos.y;
-                        if (dx > 0.0f) {
-                            continue;
-                        }
-                        float dist = std::sqrt(dx * dx + dy * dy);
-
-                        if (nearest_dist < 0.0f || dist < nearest_dist) {
-                            nearest_dist = dist;
-                            target_x = player_pos.x;
-                            target_y = player_pos.y;
-                            found_valid_target = true;
-                        }
-                    }
-                }
+                const player_targets::target* target =
+                    players.nearest(pos.x, pos.y, [](float dx, float) { return dx <= 0.0f; });
 
-                if (found_valid_target) {
-                    float dx = target_x - pos.x;
-                    float dy = target_y - pos.y;
+                if (target != nullptr) {
+                    float dx = target->x - pos.x;
+                    float dy = target->y - pos.y;
                     
                     float base_angle = std::atan2(dy, dx);
                     
@@ -194,37 +133,36 @@ void enemyShootingSystem(registry& reg, float /*dt*/) {
                     float base_vx = std::cos(base_angle) * 400.0f;
                     float base_vy = std::sin(base_angle) * 400.0f;
 
-                    static int shot_counter = 0;
                     for (int burst = 0; burst < 3; burst++) {
-                        int projectile_type = (shot_counter + burst) % 3;
+                        int projectile_type = (state.enemy3_volleys + burst) % 3;
                         float offset_x = static_cast<float>(burst - 1) * 50.0f;
                         float angle_offset = static_cast<float>(burst - 1) * 0.087f;
                         float vx = base_vx * std::cos(angle_offset) - base_vy * std::sin(angle_offset);
                         float vy = base_vx * std::sin(angle_offset) + base_vy * std::cos(angle_offset);
-                        createEnemy3Projectile(reg, pos.x - 20.0f + offset_x, pos.y - 15.0f, vx, vy, wpn.damage, projectile_type);
+                        deferSpawn(commands, createEnemy3Projectile, pos.x - 20.0f + offset_x, pos.y - 15.0f, vx, vy, wpn.damage, projectile_type);
                     }
-                    shot_counter++;
+                    state.enemy3_volleys = (state.enemy3_volleys + 1) % 3;
                 }
             } else if (entity_tag.type == RType::EntityType::FlyingEnemy) {
                 for (int burst = 0; burst < 3; burst++) {
                     float offset_y = static_cast<float>(burst - 1) * 20.0f;
-                    createFlyingEnemyProjectile(reg, pos.x - 20.0f, pos.y + offset_y, -wpn.projectile_speed, 0.0f, wpn.damage);
+                    deferSpawn(commands, createFlyingEnemyProjectile, pos.x - 20.0f, pos.y + offset_y, -wpn.projectile_speed, 0.0f, wpn.damage);
                 }
             } else if (entity_tag.type == RType::EntityType::Enemy4) {
                 float angle_up = 3.14159f - 0.5f;
                 float angle_down = 3.14159f + 0.5f;
                 float vx_up = std::cos(angle_up) * wpn.projectile_speed;
                 float vy_up = std::sin(angle_up) * wpn.projectile_speed;
-                createEnemy4Projectile(reg, pos.x - 10.0f, pos.y - 10.0f, vx_up, vy_up, wpn.damage);
+                deferSpawn(commands, createEnemy4Projectile, pos.x - 10.0f, pos.y - 10.0f, vx_up, vy_up, wpn.damage);
                 float vx_down = std::cos(angle_down) * wpn.projectile_speed;
                 float vy_down = std::sin(angle_down) * wpn.projectile_speed;
-                createEnemy4Projectile(reg, pos.x - 10.0f, pos.y + 30.0f, vx_down, vy_down, wpn.damage);
+                deferSpawn(commands, createEnemy4Projectile, pos.x - 10.0f, pos.y + 30.0f, vx_down, vy_down, wpn.damage);
             } else if (entity_tag.type == RType::EntityType::Enemy5) {
-                createEnemy5Projectile(reg, pos.x - 20.0f, pos.y + 30.0f, -wpn.projectile_speed, 0.0f, wpn.damage);
+                deferSpawn(commands, createEnemy5Projectile, pos.x - 20.0f, pos.y + 30.0f, -wpn.projectile_speed, 0.0f, wpn.damage);
             } else {
-                createEnemyProjectile(reg, pos.x - 20.0f, pos.y, -wpn.projectile_speed, 0.0f, wpn.damage);
+                deferSpawn(commands, createEnemyProjectile, pos.x - 20.0f, pos.y, -wpn.projectile_speed, 0.0f, wpn.damage);
             }
             wpn.reset_shot_timer();
         }
-    }
+    });
 }
@@ -3,6 +3,12 @@
 #include "entities/enemy_factory.hpp"
 
 void waveSystem(registry& reg, float dt) {
+    engine::CommandBuffer commands;
+    waveSystem(reg, dt, commands);
+    commands.flush(reg);
+}
+
+void waveSystem(registry& reg, float dt, engine::CommandBuffer& commands) {
     auto& wave_managers = reg.get_components<wave_manager>();
     auto& level_managers = reg.get_components<level_manager>();
 
@@ -30,8 +36,7 @@ void waveSystem(registry& reg, float dt) {
     }
 
     if (!has_manager) {
-        auto entity = reg.spawn_entity();
-        reg.emplace_component<wave_manager>(entity, 3.0f, 3);
+        commands.spawn([](registry& r, entity e) { r.emplace_component<wave_manager>(e, 3.0f, 3); });
         return;
     }
 
@@ -76,7 +81,9 @@ void waveSystem(registry& reg, float dt) {
                 manager.timer += dt;
                 if (manager.timer >= manager.spawn_interval) {
                     manager.timer = 0.0f;
-                    spawnEnemyWave(reg, manager.enemies_per_wave, current_level);
+                    commands.defer([count = manager.enemies_per_wave, current_level](registry& r) {
+                        spawnEnemyWave(r, count, current_level);
+                    });
                 }
             }
         }
@@ -36,6 +36,7 @@ struct AdminCommand {
         GetConfig,
         SetConfig,
         Shutdown,
+        Stats,
         Help
     };
 
@@ -71,6 +72,7 @@ private:
     std::string execute_close_lobby(const std::vector<std::string>& args,
                                     LobbyManager& lobby_manager);
     std::string execute_server_status(UDPServer& server, LobbyManager& lobby_manager);
+    std::string execute_stats(const std::vector<std::string>& args, LobbyManager& lobby_manager);
     std::string execute_announce(const std::vector<std::string>& args, UDPServer& server);
     std::string execute_help();
 
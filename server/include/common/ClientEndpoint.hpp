@@ -4,6 +4,7 @@
 namespace asio = boost::asio;
 
 #include <chrono>
+#include <cstddef>
 
 namespace server {
 
@@ -11,6 +12,8 @@ struct ClientEndpoint {
     asio::ip::udp::endpoint endpoint;
     int client_id;
     std::chrono::steady_clock::time_point last_seen;
+    // Socket shard the client's datagrams arrive on; replies leave through it too.
+    std::size_t shard = 0;
 
     ClientEndpoint() = default;
     ClientEndpoint(const asio::ip::udp::endpoint& ep, int id)
@@ -10,14 +10,16 @@ namespace server {
 struct NetworkPacket {
     std::vector<uint8_t> data;
     asio::ip::udp::endpoint sender;
+    // Resolved by the network thread when the packet was received; 0 on outbound packets.
+    int client_id = 0;
 
     NetworkPacket() = default;
 
     NetworkPacket(const std::vector<uint8_t>& d, const asio::ip::udp::endpoint& s)
         : data(d), sender(s) {}
 
-    NetworkPacket(std::vector<uint8_t>&& d, const asio::ip::udp::endpoint& s)
-        : data(std::move(d)), sender(s) {}
+    NetworkPacket(std::vector<uint8_t>&& d, const asio::ip::udp::endpoint& s, int id = 0)
+        : data(std::move(d)), sender(s), client_id(id) {}
 };
 
 }  // namespace server
@@ -5,6 +5,8 @@
 #include "../../game-lib/include/components/game_components.hpp"
 #include "../../game-lib/include/components/logic_components.hpp"
 #include "../../game-lib/include/entities/projectile_factory.hpp"
+#include "../../game-lib/include/systems/player_targets.hpp"
+#include "../../game-lib/include/systems/transform_hierarchy.hpp"
 #include "../../src/Common/Opcodes.hpp"
 
 #include <cmath>
@@ -31,15 +33,12 @@ public:
                             float& boss_target_x, float cycle_multiplier = 1.0f);
 
     void update_boss_behavior(registry& reg, std::optional<entity>& boss_entity,
-                              const std::unordered_map<int, std::size_t>& client_entity_ids,
-                              float& boss_animation_timer, float& boss_shoot_timer,
+                              const player_targets& players, float& boss_animation_timer, float& boss_shoot_timer,
                               float boss_shoot_cooldown, bool& boss_animation_complete,
                               bool& boss_entrance_complete, float boss_target_x,
                               int& boss_shoot_counter, float dt);
 
-    void update_homing_enemies(registry& reg,
-                               const std::unordered_map<int, std::size_t>& client_entity_ids,
-                               float dt);
+    void update_homing_enemies(registry& reg, const player_targets& players, float dt);
 
     void spawn_boss_level_10(registry& reg, std::optional<entity>& serpent_controller_entity,
                              float cycle_multiplier = 1.0f);
@@ -60,7 +59,7 @@ public:
 
 private:
     void boss_shoot_projectile(registry& reg, std::optional<entity>& boss_entity,
-                               const std::unordered_map<int, std::size_t>& client_entity_ids);
+                               const player_targets& players);
 
     void boss_spawn_homing_enemy(registry& reg, std::optional<entity>& boss_entity);
 
@@ -106,6 +105,7 @@ private:
     void spawn_boss_explosions(registry& reg, float x, float y, int count);
 
     std::mt19937 rng_{std::random_device{}()};
+    transform_hierarchy transforms_;
 };
 
 }  // namespace server
@@ -9,6 +9,7 @@
 #include "../../game-lib/include/components/logic_components.hpp"
 #include "../../game-lib/include/entities/boss_factory.hpp"
 #include "../../game-lib/include/entities/enemy_factory.hpp"
+#include "../../game-lib/include/entities/explosion_factory.hpp"
 #include "../../game-lib/include/entities/player_factory.hpp"
 #include "../../game-lib/include/entities/projectile_factory.hpp"
 #include "../../game-lib/include/level/CustomLevelManager.hpp"
@@ -40,6 +41,9 @@ namespace server {
 
 class GameSession {
 private:
+    // Live players, refreshed before the systems run and again before the
+    // boss logic; shared by every shooter and homing missile of the tick.
+    player_targets _player_targets;
     engine::GameEngine _engine;
     std::unordered_map<int, std::size_t> _client_entity_ids;
     std::unordered_map<int, bool> _client_ready_status;
@@ -135,6 +139,7 @@ public:
     void process_inputs(UDPServer& server);
     void handle_packet(UDPServer& server, int client_id, const std::vector<uint8_t>& data);
     registry& getRegistry() { return _engine.get_registry(); }
+    engine::GameEngine& getEngine() { return _engine; }
 
     void set_custom_level_id(const std::string& id) { _custom_level_id = id; }
     const std::string& get_custom_level_id() const { return _custom_level_id; }
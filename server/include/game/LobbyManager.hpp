@@ -19,6 +19,13 @@ struct LobbyInfo {
     LobbyState state;
 };
 
+struct LobbyStats {
+    int lobby_id;
+    std::string name;
+    std::size_t entities;
+    std::vector<engine::SystemStats> systems;
+};
+
 class LobbyManager {
 private:
     std::map<int, std::unique_ptr<Lobby>> _lobbies;
@@ -38,6 +45,8 @@ public:
     bool delete_lobby(int lobby_id);
     Lobby* get_lobby(int lobby_id);
     std::vector<LobbyInfo> get_lobby_list();
+    std::vector<LobbyStats> get_lobby_stats();
+    bool write_lobby_trace(int lobby_id, const std::string& path);
 
     bool join_lobby(int lobby_id, int client_id, UDPServer& server);
     bool leave_lobby(int client_id, UDPServer& server);
@@ -7,6 +7,7 @@
 
 #include <atomic>
 #include <memory>
+#include <vector>
 
 namespace server {
 
@@ -18,6 +19,8 @@ private:
 
     float _cleanup_accumulator = 0.0f;
     float _broadcast_accumulator = 0.0f;
+    std::vector<NetworkPacket> _input_batch;
+    uint64_t _reported_input_drops = 0;
 
     void process_network_events(UDPServer& server);
     void update_lobbies(UDPServer& server, float dt);
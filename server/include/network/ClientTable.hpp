@@ -0,0 +1,90 @@
+#pragma once
+
+#include "common/ClientEndpoint.hpp"
+
+#include <boost/asio.hpp>
+namespace asio = boost::asio;
+
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace server {
+
+struct EndpointHash {
+    std::size_t operator()(const asio::ip::udp::endpoint& endpoint) const noexcept {
+        std::size_t seed = std::hash<unsigned short>{}(endpoint.port());
+        auto mix = [&seed](std::size_t value) {
+            seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+        };
+        const asio::ip::address address = endpoint.address();
+        if (address.is_v4()) {
+            mix(address.to_v4().to_uint());
+        } else {
+            for (unsigned char byte : address.to_v6().to_bytes()) {
+                mix(byte);
+            }
+        }
+        return seed;
+    }
+};
+
+/**
+ * Connected clients packed in a dense array, indexed by id and by endpoint.
+ *
+ * Both lookups are a single hash probe, so resolving the sender of every
+ * received datagram no longer scans the whole client list. Removal swaps the
+ * last record into the hole, so iteration order is not stable. Not
+ * thread-safe: UDPServer guards it with its clients mutex.
+ */
+class ClientTable {
+public:
+    ClientEndpoint* find(int client_id) {
+        auto it = by_id_.find(client_id);
+        return it != by_id_.end() ? &records_[it->second] : nullptr;
+    }
+
+    ClientEndpoint* find(const asio::ip::udp::endpoint& endpoint) {
+        auto it = by_endpoint_.find(endpoint);
+        return it != by_endpoint_.end() ? &records_[it->second] : nullptr;
+    }
+
+    ClientEndpoint& add(const asio::ip::udp::endpoint& endpoint, int client_id) {
+        by_id_[client_id] = records_.size();
+        by_endpoint_[endpoint] = records_.size();
+        return records_.emplace_back(endpoint, client_id);
+    }
+
+    bool erase(int client_id) {
+        auto it = by_id_.find(client_id);
+        if (it == by_id_.end()) {
+            return false;
+        }
+        std::size_t slot = it->second;
+        by_endpoint_.erase(records_[slot].endpoint);
+        by_id_.erase(it);
+
+        if (slot != records_.size() - 1) {
+            records_[slot] = std::move(records_.back());
+            by_id_[records_[slot].client_id] = slot;
+            by_endpoint_[records_[slot].endpoint] = slot;
+        }
+        records_.pop_back();
+        return true;
+    }
+
+    std::size_t size() const noexcept { return records_.size(); }
+
+    std::vector<ClientEndpoint>::iterator begin() noexcept { return records_.begin(); }
+    std::vector<ClientEndpoint>::iterator end() noexcept { return records_.end(); }
+    std::vector<ClientEndpoint>::const_iterator begin() const noexcept { return records_.begin(); }
+    std::vector<ClientEndpoint>::const_iterator end() const noexcept { return records_.end(); }
+
+private:
+    std::vector<ClientEndpoint> records_;
+    std::unordered_map<int, std::size_t> by_id_;
+    std::unordered_map<asio::ip::udp::endpoint, std::size_t, EndpointHash> by_endpoint_;
+};
+
+}  // namespace server
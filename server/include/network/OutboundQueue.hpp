@@ -0,0 +1,54 @@
+#pragma once
+
+#include <boost/asio.hpp>
+namespace asio = boost::asio;
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace server {
+
+// One serialized packet shared by every datagram that carries it.
+using SharedPayload = std::shared_ptr<const std::vector<uint8_t>>;
+
+struct OutboundDatagram {
+    SharedPayload payload;
+    asio::ip::udp::endpoint endpoint;
+};
+
+/**
+ * Datagrams waiting for the network thread to send them.
+ *
+ * Any thread may push; the network thread takes the whole backlog at once
+ * and sends it in batches. Broadcasting to N clients queues N descriptors
+ * that point at the same payload instead of N copies of it.
+ */
+class OutboundQueue {
+public:
+    void push(SharedPayload payload, const asio::ip::udp::endpoint& endpoint) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_.push_back(OutboundDatagram{std::move(payload), endpoint});
+    }
+
+    // Replaces the contents of @p out with everything queued so far. The two
+    // vectors trade storage, so steady-state flushing does not allocate.
+    bool take(std::vector<OutboundDatagram>& out) {
+        out.clear();
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_.swap(out);
+        return !out.empty();
+    }
+
+    bool empty() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return pending_.empty();
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::vector<OutboundDatagram> pending_;
+};
+
+}  // namespace server
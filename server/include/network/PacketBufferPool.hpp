@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace server {
+
+/**
+ * Fixed set of equally sized receive slabs carved out of one allocation.
+ *
+ * The receive path leases slabs for a batch of datagrams, parses them in
+ * place and hands them back; nothing is allocated per packet. A packet that
+ * must outlive its slab (queued input, reorder buffer) is copied out first.
+ * Not thread-safe: only the network thread leases slabs.
+ */
+class PacketBufferPool {
+public:
+    PacketBufferPool(std::size_t slab_count, std::size_t slab_size)
+        : storage_(std::make_unique<uint8_t[]>(slab_count * slab_size)),
+          slab_count_(slab_count),
+          slab_size_(slab_size) {
+        free_.reserve(slab_count);
+        for (std::size_t i = slab_count; i > 0; --i) {
+            free_.push_back(i - 1);
+        }
+    }
+
+    PacketBufferPool(const PacketBufferPool&) = delete;
+    PacketBufferPool& operator=(const PacketBufferPool&) = delete;
+
+    // Empty span once every slab is leased.
+    std::span<uint8_t> acquire() noexcept {
+        if (free_.empty()) {
+            return {};
+        }
+        std::size_t index = free_.back();
+        free_.pop_back();
+        return {storage_.get() + index * slab_size_, slab_size_};
+    }
+
+    void release(std::span<uint8_t> slab) noexcept {
+        if (slab.empty()) {
+            return;
+        }
+        free_.push_back(static_cast<std::size_t>(slab.data() - storage_.get()) / slab_size_);
+    }
+
+    std::size_t available() const noexcept { return free_.size(); }
+    std::size_t capacity() const noexcept { return slab_count_; }
+    std::size_t slab_size() const noexcept { return slab_size_; }
+
+private:
+    std::unique_ptr<uint8_t[]> storage_;
+    std::size_t slab_count_;
+    std::size_t slab_size_;
+    std::vector<std::size_t> free_;
+};
+
+}  // namespace server
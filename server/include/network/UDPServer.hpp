@@ -1,20 +1,25 @@
 #pragma once
 
+#include "../../src/Common/RingBuffer.hpp"
 #include "common/ClientEndpoint.hpp"
 #include "common/NetworkPacket.hpp"
-#include "common/SafeQueue.hpp"
+#include "network/ClientTable.hpp"
+#include "network/OutboundQueue.hpp"
+#include "network/PacketBufferPool.hpp"
 #include "network/PacketReliability.hpp"
 
 #include <boost/asio.hpp>
 namespace asio = boost::asio;
 
 #include <array>
+#include <atomic>
 #include <iostream>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <queue>
+#include <span>
 #include <string>
 #include <thread>
 #include <vector>
@@ -22,30 +27,95 @@ namespace asio = boost::asio;
 namespace server {
 
 class UDPServer {
+public:
+    // Datagrams drained per recvmmsg call; also the number of receive slabs.
+    static constexpr std::size_t RECV_BATCH = 32;
+    static constexpr std::size_t MAX_DATAGRAM = 65536;
+    // Datagrams handed to the kernel per sendmmsg call.
+    static constexpr std::size_t SEND_BATCH = 64;
+    // Packets the game thread may fall behind by before new ones are dropped.
+    static constexpr std::size_t INPUT_QUEUE_CAPACITY = 4096;
+
+    // A client's id and the shard its traffic is pinned to.
+    struct RegisteredClient {
+        int client_id = 0;
+        std::size_t shard = 0;
+    };
+
 private:
+    /**
+     * One UDP socket and everything its thread touches: receive slabs, the
+     * ring its packets are queued on for the game thread, its outbound
+     * queue, and the reliability state of the clients that talk to it.
+     * Shard 0 runs on the io_context given to the constructor; the others
+     * bind the same port with SO_REUSEPORT and run their own io_context on a
+     * thread of their own.
+     */
+    struct SocketShard {
+        std::size_t index = 0;
+        asio::io_context* context = nullptr;
+        std::unique_ptr<asio::io_context> owned_context;
+        std::thread thread;
+        std::unique_ptr<asio::ip::udp::socket> socket;
+
+        asio::ip::udp::endpoint remote_endpoint;
+        PacketBufferPool recv_pool{RECV_BATCH, MAX_DATAGRAM};
+        std::span<uint8_t> recv_slab;
+        std::vector<uint8_t> decompress_scratch;
+        // Filled by this shard's thread only, drained by the game thread only.
+        RType::SpscRing<NetworkPacket> input_queue{INPUT_QUEUE_CAPACITY};
+
+        OutboundQueue output_queue;
+        // Shard thread only: the backlog being sent and how far it got.
+        std::vector<OutboundDatagram> send_batch;
+        std::size_t send_cursor = 0;
+        bool send_waiting = false;
+        std::atomic<bool> flush_posted{false};
+
+        std::map<int, RType::ClientReliabilityState> reliability;
+        std::mutex reliability_mutex;
+    };
+
     asio::io_context& io_context_;
     std::unique_ptr<asio::executor_work_guard<asio::io_context::executor_type>> work_guard_;
-    std::unique_ptr<asio::ip::udp::socket> socket_;
-    asio::ip::udp::endpoint remote_endpoint_;
-    std::map<int, ClientEndpoint> clients_;
+    std::vector<std::unique_ptr<SocketShard>> shards_;
+    ClientTable clients_;
     std::mutex clients_mutex_;
-    ThreadSafeQueue<NetworkPacket> input_queue_;
-    std::unique_ptr<std::vector<uint8_t>> recv_buffer_;
+    // Game thread only: where get_input_packet resumes its round-robin.
+    std::size_t next_input_shard_ = 0;
     int next_client_id_;
-    bool running_;
+    std::atomic<bool> running_;
 
-    std::map<int, RType::ClientReliabilityState> client_reliability_;
-    std::mutex reliability_mutex_;
     std::thread retry_thread_;
 
+    std::unique_ptr<asio::ip::udp::socket> open_socket(asio::io_context& context,
+                                                       const std::string& bind_address,
+                                                       unsigned short port, bool reuse_port);
+    void run_shard(SocketShard& shard);
+    void start_receive(SocketShard& shard);
+    void handle_receive(SocketShard& shard, std::error_code ec, std::size_t bytes_received);
+#ifdef __linux__
+    void drain_socket(SocketShard& shard, std::error_code ec);
+    bool send_batch(SocketShard& shard);
+#endif
+    void dispatch_datagram(SocketShard& shard, std::span<const uint8_t> datagram,
+                           const asio::ip::udp::endpoint& sender);
+    void send_queued(SocketShard& shard);
+    void queue_ack(SocketShard& shard, const asio::ip::udp::endpoint& sender,
+                   uint32_t sequence_id);
+    void handle_ack(SocketShard& shard, int client_id, uint32_t sequence_id);
+    SocketShard& shard_of(int client_id);
+    void retry_unacked_packets(std::map<int, RType::ClientReliabilityState>& states,
+                               std::chrono::steady_clock::time_point now);
+
 public:
-    UDPServer(asio::io_context& io_context, const std::string& bind_address, unsigned short port);
+    // @p socket_shards > 1 opens that many sockets on the port (Linux only).
+    UDPServer(asio::io_context& io_context, const std::string& bind_address, unsigned short port,
+              std::size_t socket_shards = 1);
     ~UDPServer();
 
-    void start_receive();
-    void handle_receive(std::error_code ec, std::size_t bytes_received);
-
-    int register_client(const asio::ip::udp::endpoint& endpoint);
+    RegisteredClient register_client(const asio::ip::udp::endpoint& endpoint,
+                                     std::size_t shard = 0);
     std::vector<int> remove_inactive_clients(std::chrono::seconds timeout);
     size_t get_client_count();
     std::map<int, ClientEndpoint> get_clients();
@@ -57,6 +127,10 @@ public:
     void send_to_client(int client_id, const std::vector<uint8_t>& data);
     void send_to_endpoint(const asio::ip::udp::endpoint& endpoint,
                           const std::vector<uint8_t>& data);
+    void send_to_clients(const std::vector<int>& client_ids, SharedPayload payload);
+    // Hands everything queued by the send_* calls to the network threads;
+    // safe from any thread. The game loop calls it once per tick.
+    void flush_output();
 
     void send_reliable(int client_id, uint8_t opcode, const std::vector<uint8_t>& payload);
     void send_ack(int client_id, uint32_t sequence_id);
@@ -66,9 +140,15 @@ public:
     void cleanup_client_reliability(int client_id);
 
     bool get_input_packet(NetworkPacket& packet);
+    // Replaces the contents of @p packets with everything received so far.
+    std::size_t get_input_packets(std::vector<NetworkPacket>& packets);
     void queue_output_packet(NetworkPacket packet);
 
     size_t get_input_queue_size() const;
+    uint64_t get_input_dropped_count() const;
+    std::size_t get_shard_count() const { return shards_.size(); }
+    // The port every shard is bound to; the one picked by the OS for port 0.
+    unsigned short get_port() const { return shards_.front()->socket->local_endpoint().port(); }
 
     void run_network_loop();
     void stop();
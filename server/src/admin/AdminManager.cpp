@@ -121,6 +121,11 @@ AdminCommand AdminManager::parse_command(const std::string& command_str) {
         }
     } else if (command == "status") {
         cmd.type = AdminCommand::Type::ServerStatus;
+    } else if (command == "stats") {
+        cmd.type = AdminCommand::Type::Stats;
+        if (words.size() > 1) {
+            cmd.args.assign(words.begin() + 1, words.end());
+        }
     } else if (command == "announce") {
         cmd.type = AdminCommand::Type::Announce;
         if (words.size() > 1) {
@@ -160,6 +165,8 @@ std::string AdminManager::execute_command(int client_id, const std::string& comm
             return execute_close_lobby(cmd.args, lobby_manager);
         case AdminCommand::Type::ServerStatus:
             return execute_server_status(server, lobby_manager);
+        case AdminCommand::Type::Stats:
+            return execute_stats(cmd.args, lobby_manager);
         case AdminCommand::Type::Announce:
             return execute_announce(cmd.args, server);
         case AdminCommand::Type::Help:
@@ -256,6 +263,49 @@ std::string AdminManager::execute_server_status(UDPServer& server, LobbyManager&
     return ss.str();
 }
 
+std::string AdminManager::execute_stats(const std::vector<std::string>& args,
+                                        LobbyManager& lobby_manager) {
+    if (!args.empty()) {
+        if (args[0] != "trace" || args.size() < 2) {
+            return "ERROR: Usage: stats [trace <lobby_id>]";
+        }
+        try {
+            int lobby_id = std::stoi(args[1]);
+            std::string path = "trace_lobby_" + std::to_string(lobby_id) + ".json";
+            if (!lobby_manager.write_lobby_trace(lobby_id, path)) {
+                return "ERROR: Could not write trace for lobby " + std::to_string(lobby_id);
+            }
+            return "OK: Trace written to " + path;
+        } catch (...) {
+            return "ERROR: Invalid lobby ID";
+        }
+    }
+
+    auto lobbies = lobby_manager.get_lobby_stats();
+
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3);
+    ss << "STATS|" << lobbies.size() << "|";
+
+    for (const auto& lobby : lobbies) {
+        ss << "LOBBY;" << lobby.lobby_id << ";" << lobby.name << ";" << lobby.entities << ";"
+           << lobby.systems.size() << "|";
+        for (const auto& system : lobby.systems) {
+            ss << system.name << ";" << system.stage << ";" << system.samples << ";"
+               << system.min_ms << ";" << system.avg_ms << ";" << system.p99_ms << ";"
+               << system.entities << ";";
+            if (engine::SystemProfiler::tracks_allocations()) {
+                ss << system.allocations;
+            } else {
+                ss << "-";
+            }
+            ss << "|";
+        }
+    }
+
+    return ss.str();
+}
+
 std::string AdminManager::execute_announce(const std::vector<std::string>& args,
                                            UDPServer& server) {
     (void)server;
@@ -283,6 +333,7 @@ std::string AdminManager::execute_help() {
        << "list-lobbies - Show all active lobbies|"
        << "close-lobby <id> - Close a lobby|"
        << "status - Show server status|"
+       << "stats [trace <lobby_id>] - Show system timings, or dump a Chrome trace|"
        << "announce <message> - Send announcement|"
        << "help - Show this help";
 
@@ -1,5 +1,8 @@
 #include "game/BossManager.hpp"
 
+#include "../../engine/ecs/prefab.hpp"
+#include "../../game-lib/include/systems/despawn_schedule.hpp"
+
 #include <array>
 
 #if defined(__GNUC__) && !defined(__clang__)
@@ -11,10 +14,8 @@ namespace server {
 
 static float get_difficulty_multiplier(registry& reg) {
     auto& settings = reg.get_components<game_settings>();
-    for (const auto& setting : settings) {
-        if (setting.has_value()) {
-            return setting->difficulty_multiplier;
-        }
+    if (settings.dense_size() > 0) {
+        return settings.dense_value(0).difficulty_multiplier;
     }
     return 1.0f;
 }
@@ -99,8 +100,8 @@ void BossManager::spawn_boss_level_5(registry& reg, std::optional<entity>& boss_
 }
 
 void BossManager::update_boss_behavior(
-    registry& reg, std::optional<entity>& boss_entity,
-    const std::unordered_map<int, std::size_t>& client_entity_ids, float& boss_animation_timer,
+    registry& reg, std::optional<entity>& boss_entity, const player_targets& players,
+    float& boss_animation_timer,
     float& boss_shoot_timer, float boss_shoot_cooldown, bool& boss_animation_complete,
     bool& boss_entrance_complete, float boss_target_x, int& boss_shoot_counter, float dt) {
     if (!boss_entity.has_value()) {
@@ -125,11 +126,9 @@ void BossManager::update_boss_behavior(
                 }
             }
 
-            try {
-                auto boss_ent = boss_entity.value();
-                reg.remove_component<entity_tag>(boss_ent);
-                reg.kill_entity(boss_ent);
-            } catch (...) {}
+            auto boss_ent = boss_entity.value();
+            reg.remove_component<entity_tag>(boss_ent);
+            reg.kill_entity(boss_ent);
             boss_entity = std::nullopt;
         }
         return;
@@ -142,7 +141,7 @@ void BossManager::update_boss_behavior(
             spawn_boss_explosions(reg, boss_pos_opt->x, boss_pos_opt->y, 25);
         }
 
-        explosion_tag death_timer(1.2f);
+        explosion_tag death_timer(0.4f);
         death_timer.elapsed = 0.0f;
         reg.add_component(boss_entity.value(), death_timer);
 
@@ -182,7 +181,7 @@ void BossManager::update_boss_behavior(
         boss_shoot_timer += dt;
 
         if (boss_shoot_timer >= boss_shoot_cooldown) {
-            boss_shoot_projectile(reg, boss_entity, client_entity_ids);
+            boss_shoot_projectile(reg, boss_entity, players);
             boss_shoot_counter++;
 
             if (boss_shoot_counter >= 3) {
@@ -195,9 +194,8 @@ void BossManager::update_boss_behavior(
     }
 }
 
-void BossManager::boss_shoot_projectile(
-    registry& reg, std::optional<entity>& boss_entity,
-    const std::unordered_map<int, std::size_t>& client_entity_ids) {
+void BossManager::boss_shoot_projectile(registry& reg, std::optional<entity>& boss_entity,
+                                        const player_targets& players) {
     if (!boss_entity.has_value()) {
         return;
     }
@@ -210,25 +208,13 @@ void BossManager::boss_shoot_projectile(
     float boss_x = boss_pos_opt->x;
     float boss_y = boss_pos_opt->y;
 
-    std::vector<std::pair<float, float>> player_positions;
-    for (const auto& [client_id, entity_id] : client_entity_ids) {
-        auto player = reg.entity_from_index(entity_id);
-        auto player_pos_opt = reg.get_component<position>(player);
-        auto player_health_opt = reg.get_component<health>(player);
-
-        if (player_pos_opt.has_value() && player_health_opt.has_value() &&
-            player_health_opt->current > 0) {
-            player_positions.push_back({player_pos_opt->x, player_pos_opt->y});
-        }
-    }
-
-    if (player_positions.empty()) {
+    if (players.empty()) {
         return;
     }
 
-    for (const auto& [target_x, target_y] : player_positions) {
-        float dx = target_x - boss_x;
-        float dy = target_y - boss_y;
+    for (const player_targets::target& target : players.all()) {
+        float dx = target.x - boss_x;
+        float dy = target.y - boss_y;
         float distance = std::sqrt(dx * dx + dy * dy);
 
         if (distance < 1.0f) {
@@ -254,6 +240,7 @@ void BossManager::boss_shoot_projectile(
         reg.add_component(projectile, enemy_tag{});
 
         reg.add_component(projectile, entity_tag{static_cast<RType::EntityType>(0x07)});
+        reg.add_component(projectile, collision_layer::boss_projectile());
     }
 }
 
@@ -290,8 +277,7 @@ void BossManager::boss_spawn_homing_enemy(registry& reg, std::optional<entity>&
     reg.add_component(homing, entity_tag{RType::EntityType::HomingEnemy});
 }
 
-void BossManager::update_homing_enemies(
-    registry& reg, const std::unordered_map<int, std::size_t>& client_entity_ids, float dt) {
+void BossManager::update_homing_enemies(registry& reg, const player_targets& players, float dt) {
     auto& positions = reg.get_components<position>();
     auto& velocities = reg.get_components<velocity>();
     auto& homing_comps = reg.get_components<homing_component>();
@@ -308,36 +294,15 @@ void BossManager::update_homing_enemies(
         float homing_x = positions[i]->x;
         float homing_y = positions[i]->y;
 
-        float closest_distance = std::numeric_limits<float>::max();
-        float target_x = 0.0f;
-        float target_y = 0.0f;
-        bool found_target = false;
-
-        for (const auto& [client_id, entity_id] : client_entity_ids) {
-            auto player = reg.entity_from_index(entity_id);
-            auto player_pos_opt = reg.get_component<position>(player);
-            auto player_health_opt = reg.get_component<health>(player);
-
-            if (player_pos_opt.has_value() && player_health_opt.has_value() &&
-                player_health_opt->current > 0) {
-                float dx = player_pos_opt->x - homing_x;
-                float dy = player_pos_opt->y - homing_y;
-                float distance = std::sqrt(dx * dx + dy * dy);
-
-                if (distance < closest_distance) {
-                    closest_distance = distance;
-                    target_x = player_pos_opt->x;
-                    target_y = player_pos_opt->y;
-                    found_target = true;
-                }
-            }
+        const player_targets::target* target = players.nearest(homing_x, homing_y);
+        if (target == nullptr) {
+            continue;
         }
+        float dx = target->x - homing_x;
+        float dy = target->y - homing_y;
+        float distance = std::sqrt(dx * dx + dy * dy);
 
-        if (found_target && closest_distance > 10.0f) {
-            float dx = target_x - homing_x;
-            float dy = target_y - homing_y;
-            float distance = std::sqrt(dx * dx + dy * dy);
-
+        if (distance > 10.0f) {
             float desired_vx = (dx / distance) * homing_comps[i]->speed;
             float desired_vy = (dy / distance) * homing_comps[i]->speed;
 
@@ -486,6 +451,7 @@ void BossManager::spawn_serpent_scale_on_body(registry& reg, serpent_boss_contro
     sp.can_attack = true;
     sp.attack_cooldown = 2.5f;
     reg.add_component(scale, sp);
+    reg.add_component(scale, transform_link{body_entity});
 
     controller.scale_entities.push_back(scale);
 }
@@ -527,7 +493,7 @@ void BossManager::update_serpent_spawn_animation(registry& reg, serpent_boss_con
                 if (!controller.body_entities.empty()) {
                     for (int j = static_cast<int>(controller.body_entities.size()) - 1; j >= 0;
                          --j) {
-                        auto& tag_opt = reg.get_component<entity_tag>(
+                        auto tag_opt = reg.get_component<entity_tag>(
                             controller.body_entities[static_cast<std::size_t>(j)]);
                         if (tag_opt.has_value() &&
                             tag_opt->type == RType::EntityType::SerpentBody) {
@@ -548,7 +514,7 @@ void BossManager::update_serpent_spawn_animation(registry& reg, serpent_boss_con
                 int body_index = index;
                 if (body_index % 3 == 0) {
                     entity last_body = controller.body_entities.back();
-                    auto& body_pos = reg.get_component<position>(last_body);
+                    auto body_pos = reg.get_component<position>(last_body);
                     if (body_pos.has_value()) {
                         spawn_serpent_scale_on_body(
                             reg, controller, last_body, body_pos->x, body_pos->y,
@@ -559,7 +525,7 @@ void BossManager::update_serpent_spawn_animation(registry& reg, serpent_boss_con
                 if (!controller.body_entities.empty()) {
                     for (int j = static_cast<int>(controller.body_entities.size()) - 1; j >= 0;
                          --j) {
-                        auto& tag_opt = reg.get_component<entity_tag>(
+                        auto tag_opt = reg.get_component<entity_tag>(
                             controller.body_entities[static_cast<std::size_t>(j)]);
                         if (tag_opt.has_value() &&
                             tag_opt->type == RType::EntityType::SerpentBody) {
@@ -589,8 +555,8 @@ void BossManager::update_serpent_movement(registry& reg, serpent_boss_controller
 
     controller.movement_timer += dt;
 
-    auto& head_pos = reg.get_component<position>(controller.head_entity.value());
-    auto& head_vel = reg.get_component<velocity>(controller.head_entity.value());
+    auto head_pos = reg.get_component<position>(controller.head_entity.value());
+    auto head_vel = reg.get_component<velocity>(controller.head_entity.value());
 
     if (!head_pos.has_value() || !head_vel.has_value()) {
         return;
@@ -638,7 +604,7 @@ void BossManager::update_serpent_movement(registry& reg, serpent_boss_controller
         head_vel->vy = base_vy + perp_y * wave_offset * 0.2f;
     }
 
-    auto& head_history = reg.get_component<position_history>(controller.head_entity.value());
+    auto head_history = reg.get_component<position_history>(controller.head_entity.value());
     if (head_history.has_value()) {
         head_history->add_position(head_pos->x, head_pos->y);
     }
@@ -657,16 +623,16 @@ void BossManager::update_serpent_parts_follow(registry& reg, serpent_boss_contro
     for (size_t i = 0; i < controller.body_entities.size(); ++i) {
         entity part_ent = controller.body_entities[i];
 
-        auto& part_pos = reg.get_component<position>(part_ent);
-        auto& part_comp = reg.get_component<serpent_part>(part_ent);
-        auto& part_history = reg.get_component<position_history>(part_ent);
+        auto part_pos = reg.get_component<position>(part_ent);
+        auto part_comp = reg.get_component<serpent_part>(part_ent);
+        auto part_history = reg.get_component<position_history>(part_ent);
 
         if (!part_pos.has_value() || !part_comp.has_value()) {
             continue;
         }
 
         if (prev_entity.has_value()) {
-            auto& prev_pos = reg.get_component<position>(prev_entity.value());
+            auto prev_pos = reg.get_component<position>(prev_entity.value());
             if (prev_pos.has_value()) {
                 float dx = prev_pos->x - part_pos->x;
                 float dy = prev_pos->y - part_pos->y;
@@ -695,28 +661,12 @@ void BossManager::update_serpent_parts_follow(registry& reg, serpent_boss_contro
         prev_entity = part_ent;
     }
 
-    for (entity scale_ent : controller.scale_entities) {
-        auto& scale_pos = reg.get_component<position>(scale_ent);
-        auto& scale_comp = reg.get_component<serpent_part>(scale_ent);
-
-        if (!scale_pos.has_value() || !scale_comp.has_value()) {
-            continue;
-        }
-
-        if (scale_comp->attached_body.has_value()) {
-            try {
-                auto& body_pos = reg.get_component<position>(scale_comp->attached_body.value());
-                if (body_pos.has_value()) {
-                    scale_pos->x = body_pos->x;
-                    scale_pos->y = body_pos->y;
-                }
-            } catch (...) {}
-        }
-    }
+    // Scales ride on their body through transform_link.
+    transforms_.update(reg);
 
     if (controller.tail_entity.has_value() && prev_entity.has_value()) {
-        auto& tail_pos = reg.get_component<position>(controller.tail_entity.value());
-        auto& prev_pos = reg.get_component<position>(prev_entity.value());
+        auto tail_pos = reg.get_component<position>(controller.tail_entity.value());
+        auto prev_pos = reg.get_component<position>(prev_entity.value());
 
         if (tail_pos.has_value() && prev_pos.has_value()) {
             float dx = prev_pos->x - tail_pos->x;
@@ -744,8 +694,8 @@ void BossManager::update_serpent_rotations(
     registry& reg, serpent_boss_controller& controller,
     const std::unordered_map<int, std::size_t>& client_entity_ids) {
     if (controller.head_entity.has_value()) {
-        auto& head_vel = reg.get_component<velocity>(controller.head_entity.value());
-        auto& head_part = reg.get_component<serpent_part>(controller.head_entity.value());
+        auto head_vel = reg.get_component<velocity>(controller.head_entity.value());
+        auto head_part = reg.get_component<serpent_part>(controller.head_entity.value());
 
         if (head_vel.has_value() && head_part.has_value()) {
             if (std::abs(head_vel->vx) > 0.1f || std::abs(head_vel->vy) > 0.1f) {
@@ -758,8 +708,8 @@ void BossManager::update_serpent_rotations(
     for (size_t i = 0; i < controller.body_entities.size(); ++i) {
         entity part_ent = controller.body_entities[i];
 
-        auto& part_pos = reg.get_component<position>(part_ent);
-        auto& part_comp = reg.get_component<serpent_part>(part_ent);
+        auto part_pos = reg.get_component<position>(part_ent);
+        auto part_comp = reg.get_component<serpent_part>(part_ent);
 
         if (!part_pos.has_value() || !part_comp.has_value()) {
             continue;
@@ -773,7 +723,7 @@ void BossManager::update_serpent_rotations(
         }
 
         if (next_entity.has_value()) {
-            auto& next_pos = reg.get_component<position>(next_entity.value());
+            auto next_pos = reg.get_component<position>(next_entity.value());
             if (next_pos.has_value()) {
                 float dx = next_pos->x - part_pos->x;
                 float dy = next_pos->y - part_pos->y;
@@ -784,25 +734,25 @@ void BossManager::update_serpent_rotations(
     }
 
     for (entity scale_ent : controller.scale_entities) {
-        auto& scale_pos = reg.get_component<position>(scale_ent);
-        auto& scale_comp = reg.get_component<serpent_part>(scale_ent);
+        auto scale_pos = reg.get_component<position>(scale_ent);
+        auto scale_comp = reg.get_component<serpent_part>(scale_ent);
 
         if (!scale_pos.has_value() || !scale_comp.has_value()) {
             continue;
         }
 
-        float closest_dist = 999999.0f;
+        float closest_dist_sq = 999999.0f * 999999.0f;
         float closest_px = 960.0f, closest_py = 540.0f;
 
         for (const auto& [client_id, entity_idx] : client_entity_ids) {
             auto player_ent = reg.entity_from_index(entity_idx);
-            auto& player_pos = reg.get_component<position>(player_ent);
+            auto player_pos = reg.get_component<position>(player_ent);
             if (player_pos.has_value()) {
                 float dx = player_pos->x - scale_pos->x;
                 float dy = player_pos->y - scale_pos->y;
-                float dist = std::sqrt(dx * dx + dy * dy);
-                if (dist < closest_dist) {
-                    closest_dist = dist;
+                float dist_sq = dx * dx + dy * dy;
+                if (dist_sq < closest_dist_sq) {
+                    closest_dist_sq = dist_sq;
                     closest_px = player_pos->x;
                     closest_py = player_pos->y;
                 }
@@ -816,8 +766,8 @@ void BossManager::update_serpent_rotations(
     }
 
     if (controller.tail_entity.has_value()) {
-        auto& tail_pos = reg.get_component<position>(controller.tail_entity.value());
-        auto& tail_part = reg.get_component<serpent_part>(controller.tail_entity.value());
+        auto tail_pos = reg.get_component<position>(controller.tail_entity.value());
+        auto tail_part = reg.get_component<serpent_part>(controller.tail_entity.value());
 
         if (tail_pos.has_value() && tail_part.has_value()) {
             std::optional<entity> last_body;
@@ -826,7 +776,7 @@ void BossManager::update_serpent_rotations(
             }
 
             if (last_body.has_value()) {
-                auto& body_pos = reg.get_component<position>(last_body.value());
+                auto body_pos = reg.get_component<position>(last_body.value());
                 if (body_pos.has_value()) {
                     float dx = body_pos->x - tail_pos->x;
                     float dy = body_pos->y - tail_pos->y;
@@ -852,13 +802,29 @@ void BossManager::update_serpent_boss(registry& reg,
         return;
     }
 
-    auto& ctrl_opt = reg.get_component<serpent_boss_controller>(serpent_controller_entity.value());
+    auto ctrl_opt = reg.get_component<serpent_boss_controller>(serpent_controller_entity.value());
     if (!ctrl_opt.has_value()) {
         return;
     }
 
     auto& controller = ctrl_opt.value();
 
+    // Parts can be reaped elsewhere (e.g. cleanupSystem killing them off-screen);
+    // drop those handles so their recycled slots are never mistaken for serpent parts.
+    auto is_dead = [&reg](entity const& e) { return !reg.is_alive(e); };
+    controller.body_entities.erase(std::remove_if(controller.body_entities.begin(),
+                                                  controller.body_entities.end(), is_dead),
+                                   controller.body_entities.end());
+    controller.scale_entities.erase(std::remove_if(controller.scale_entities.begin(),
+                                                   controller.scale_entities.end(), is_dead),
+                                    controller.scale_entities.end());
+    for (auto* part : {&controller.nest_entity, &controller.head_entity,
+                       &controller.tail_entity, &controller.laser_entity}) {
+        if (part->has_value() && is_dead(part->value())) {
+            *part = std::nullopt;
+        }
+    }
+
     if (controller.is_defeated()) {
         auto& positions = reg.get_components<position>();
 
@@ -911,39 +877,27 @@ void BossManager::update_serpent_boss(registry& reg,
         }
 
         if (controller.nest_entity.has_value()) {
-            try {
-                reg.remove_component<entity_tag>(controller.nest_entity.value());
-                reg.kill_entity(controller.nest_entity.value());
-            } catch (...) {}
+            reg.remove_component<entity_tag>(controller.nest_entity.value());
+            reg.kill_entity(controller.nest_entity.value());
         }
         if (controller.head_entity.has_value()) {
-            try {
-                reg.remove_component<entity_tag>(controller.head_entity.value());
-                reg.kill_entity(controller.head_entity.value());
-            } catch (...) {}
+            reg.remove_component<entity_tag>(controller.head_entity.value());
+            reg.kill_entity(controller.head_entity.value());
         }
         for (auto& body_ent : controller.body_entities) {
-            try {
-                reg.remove_component<entity_tag>(body_ent);
-                reg.kill_entity(body_ent);
-            } catch (...) {}
+            reg.remove_component<entity_tag>(body_ent);
+            reg.kill_entity(body_ent);
         }
         for (auto& scale_ent : controller.scale_entities) {
-            try {
-                reg.remove_component<entity_tag>(scale_ent);
-                reg.kill_entity(scale_ent);
-            } catch (...) {}
+            reg.remove_component<entity_tag>(scale_ent);
+            reg.kill_entity(scale_ent);
         }
         if (controller.tail_entity.has_value()) {
-            try {
-                reg.remove_component<entity_tag>(controller.tail_entity.value());
-                reg.kill_entity(controller.tail_entity.value());
-            } catch (...) {}
+            reg.remove_component<entity_tag>(controller.tail_entity.value());
+            reg.kill_entity(controller.tail_entity.value());
         }
 
-        try {
-            reg.kill_entity(serpent_controller_entity.value());
-        } catch (...) {}
+        reg.kill_entity(serpent_controller_entity.value());
         serpent_controller_entity = std::nullopt;
         return;
     }
@@ -968,7 +922,7 @@ void BossManager::update_serpent_boss(registry& reg,
                 (head_idx < explosion_tags.size() && explosion_tags[head_idx].has_value());
             if (!has_explosion_tag && head_health.current <= 0) {
                 if (head_idx < positions.size() && positions[head_idx].has_value()) {
-                    explosion_tag death_timer(1.2f);
+                    explosion_tag death_timer(0.4f);
                     death_timer.elapsed = 0.0f;
                     reg.add_component(controller.head_entity.value(), death_timer);
                 }
@@ -977,11 +931,9 @@ void BossManager::update_serpent_boss(registry& reg,
                 auto& exp_tag = explosion_tags[head_idx].value();
                 exp_tag.elapsed += dt;
                 if (exp_tag.elapsed >= exp_tag.lifetime) {
-                    try {
-                        reg.remove_component<entity_tag>(controller.head_entity.value());
-                        reg.kill_entity(controller.head_entity.value());
-                        controller.head_entity = std::nullopt;
-                    } catch (...) {}
+                    reg.remove_component<entity_tag>(controller.head_entity.value());
+                    reg.kill_entity(controller.head_entity.value());
+                    controller.head_entity = std::nullopt;
                 }
             }
         }
@@ -995,7 +947,7 @@ void BossManager::update_serpent_boss(registry& reg,
                 (body_idx < explosion_tags.size() && explosion_tags[body_idx].has_value());
             if (!has_explosion_tag && body_health.current <= 0) {
                 if (body_idx < positions.size() && positions[body_idx].has_value()) {
-                    explosion_tag death_timer(0.6f);
+                    explosion_tag death_timer(0.2f);
                     death_timer.elapsed = 0.0f;
                     reg.add_component(body_ent, death_timer);
                 }
@@ -1010,13 +962,11 @@ void BossManager::update_serpent_boss(registry& reg,
         }
     }
     for (auto& body_ent : body_parts_to_remove) {
-        try {
-            reg.remove_component<entity_tag>(body_ent);
-            reg.kill_entity(body_ent);
-            controller.body_entities.erase(std::remove(controller.body_entities.begin(),
-                                                       controller.body_entities.end(), body_ent),
-                                           controller.body_entities.end());
-        } catch (...) {}
+        reg.remove_component<entity_tag>(body_ent);
+        reg.kill_entity(body_ent);
+        controller.body_entities.erase(std::remove(controller.body_entities.begin(),
+                                                   controller.body_entities.end(), body_ent),
+                                       controller.body_entities.end());
     }
     std::vector<entity> scale_parts_to_remove;
     for (auto& scale_ent : controller.scale_entities) {
@@ -1027,7 +977,7 @@ void BossManager::update_serpent_boss(registry& reg,
                 (scale_idx < explosion_tags.size() && explosion_tags[scale_idx].has_value());
             if (!has_explosion_tag && scale_health.current <= 0) {
                 if (scale_idx < positions.size() && positions[scale_idx].has_value()) {
-                    explosion_tag death_timer(0.8f);
+                    explosion_tag death_timer(0.27f);
                     death_timer.elapsed = 0.0f;
                     reg.add_component(scale_ent, death_timer);
                 }
@@ -1042,13 +992,11 @@ void BossManager::update_serpent_boss(registry& reg,
         }
     }
     for (auto& scale_ent : scale_parts_to_remove) {
-        try {
-            reg.remove_component<entity_tag>(scale_ent);
-            reg.kill_entity(scale_ent);
-            controller.scale_entities.erase(std::remove(controller.scale_entities.begin(),
-                                                        controller.scale_entities.end(), scale_ent),
-                                            controller.scale_entities.end());
-        } catch (...) {}
+        reg.remove_component<entity_tag>(scale_ent);
+        reg.kill_entity(scale_ent);
+        controller.scale_entities.erase(std::remove(controller.scale_entities.begin(),
+                                                    controller.scale_entities.end(), scale_ent),
+                                        controller.scale_entities.end());
     }
     if (controller.tail_entity.has_value()) {
         std::size_t tail_idx = static_cast<std::size_t>(controller.tail_entity.value());
@@ -1058,7 +1006,7 @@ void BossManager::update_serpent_boss(registry& reg,
                 (tail_idx < explosion_tags.size() && explosion_tags[tail_idx].has_value());
             if (!has_explosion_tag && tail_health.current <= 0) {
                 if (tail_idx < positions.size() && positions[tail_idx].has_value()) {
-                    explosion_tag death_timer(0.7f);
+                    explosion_tag death_timer(0.23f);
                     death_timer.elapsed = 0.0f;
                     reg.add_component(controller.tail_entity.value(), death_timer);
                 }
@@ -1067,18 +1015,16 @@ void BossManager::update_serpent_boss(registry& reg,
                 auto& exp_tag = explosion_tags[tail_idx].value();
                 exp_tag.elapsed += dt;
                 if (exp_tag.elapsed >= exp_tag.lifetime) {
-                    try {
-                        reg.remove_component<entity_tag>(controller.tail_entity.value());
-                        reg.kill_entity(controller.tail_entity.value());
-                        controller.tail_entity = std::nullopt;
-                    } catch (...) {}
+                    reg.remove_component<entity_tag>(controller.tail_entity.value());
+                    reg.kill_entity(controller.tail_entity.value());
+                    controller.tail_entity = std::nullopt;
                 }
             }
         }
     }
 
     if (controller.head_entity.has_value()) {
-        auto& head_health = reg.get_component<health>(controller.head_entity.value());
+        auto head_health = reg.get_component<health>(controller.head_entity.value());
         if (head_health.has_value()) {
             head_health->current = controller.current_health;
             head_health->maximum = controller.total_health;
@@ -1109,13 +1055,14 @@ void BossManager::update_serpent_attacks(
         controller.scream_elapsed += dt;
 
         if (controller.head_entity.has_value()) {
-            auto& head_pos = reg.get_component<position>(controller.head_entity.value());
+            auto head_pos = reg.get_component<position>(controller.head_entity.value());
             if (head_pos.has_value()) {
                 entity scream_effect = reg.spawn_entity();
                 reg.add_component(scream_effect, position{head_pos->x, head_pos->y});
                 reg.add_component(scream_effect, velocity{0.0f, 0.0f});
                 reg.add_component(scream_effect, entity_tag{static_cast<RType::EntityType>(0x18)});
-                reg.add_component(scream_effect, explosion_tag{0.05f});
+                reg.add_component(scream_effect, explosion_tag{0.025f});
+                despawn_schedule_of(reg).expire_after(scream_effect, 0.025f);
             }
         }
 
@@ -1151,7 +1098,7 @@ void BossManager::serpent_scale_shoot(
     controller.current_scale_index =
         (controller.current_scale_index + 1) % static_cast<int>(controller.scale_entities.size());
 
-    auto& scale_pos = reg.get_component<position>(scale_ent);
+    auto scale_pos = reg.get_component<position>(scale_ent);
     if (!scale_pos.has_value())
         return;
 
@@ -1189,13 +1136,14 @@ void BossManager::serpent_scale_shoot(
     reg.add_component(projectile, projectile_tag{});
     reg.add_component(projectile, enemy_tag{});
     reg.add_component(projectile, entity_tag{static_cast<RType::EntityType>(0x07)});
+    reg.add_component(projectile, collision_layer::boss_projectile());
 }
 
 void BossManager::serpent_scream_attack(registry& reg, serpent_boss_controller& controller) {
     if (!controller.head_entity.has_value())
         return;
 
-    auto& head_pos = reg.get_component<position>(controller.head_entity.value());
+    auto head_pos = reg.get_component<position>(controller.head_entity.value());
     if (!head_pos.has_value())
         return;
 
@@ -1266,7 +1214,7 @@ void BossManager::serpent_laser_attack(
     if (!controller.tail_entity.has_value())
         return;
 
-    auto& tail_pos = reg.get_component<position>(controller.tail_entity.value());
+    auto tail_pos = reg.get_component<position>(controller.tail_entity.value());
     if (!tail_pos.has_value())
         return;
 
@@ -1278,7 +1226,8 @@ void BossManager::serpent_laser_attack(
         reg.add_component(charge_effect, position{tail_pos->x, tail_pos->y});
         reg.add_component(charge_effect, velocity{0.0f, charge_progress * 100.0f});
         reg.add_component(charge_effect, entity_tag{static_cast<RType::EntityType>(0x19)});
-        reg.add_component(charge_effect, explosion_tag{0.05f});
+        reg.add_component(charge_effect, explosion_tag{0.025f});
+        despawn_schedule_of(reg).expire_after(charge_effect, 0.025f);
 
         if (controller.laser_elapsed >= controller.laser_charge_duration) {
             controller.laser_charging = false;
@@ -1330,7 +1279,8 @@ void BossManager::serpent_laser_attack(
         reg.add_component(laser_origin, projectile_tag{});
         reg.add_component(laser_origin, enemy_tag{});
         reg.add_component(laser_origin, entity_tag{static_cast<RType::EntityType>(0x16)});
-        reg.add_component(laser_origin, explosion_tag{0.05f});
+        reg.add_component(laser_origin, explosion_tag{0.025f});
+        despawn_schedule_of(reg).expire_after(laser_origin, 0.025f);
 
         for (int i = 2; i <= num_segments; ++i) {
             float dist = static_cast<float>(i) * segment_spacing;
@@ -1347,7 +1297,8 @@ void BossManager::serpent_laser_attack(
             reg.add_component(laser_seg, projectile_tag{});
             reg.add_component(laser_seg, enemy_tag{});
             reg.add_component(laser_seg, entity_tag{static_cast<RType::EntityType>(0x17)});
-            reg.add_component(laser_seg, explosion_tag{0.05f});
+            reg.add_component(laser_seg, explosion_tag{0.025f});
+            despawn_schedule_of(reg).expire_after(laser_seg, 0.025f);
         }
 
         if (controller.laser_elapsed >= controller.laser_fire_duration) {
@@ -1655,6 +1606,9 @@ void BossManager::update_compiler_boss(
         if (controller.part3_entity.has_value()) {
             reg.kill_entity(controller.part3_entity.value());
         }
+        if (controller.formation_anchor.has_value()) {
+            reg.kill_entity(controller.formation_anchor.value());
+        }
         reg.kill_entity(compiler_controller_entity.value());
         compiler_controller_entity = std::nullopt;
         return;
@@ -1748,23 +1702,35 @@ void BossManager::update_compiler_assembled(
     float oscillation_x = std::sin(controller.state_timer * 2.0f) * 30.0f;
     float oscillation_y = std::sin(controller.state_timer * 1.5f) * 20.0f;
 
-    auto update_part_position = [&](std::optional<entity>& part_ent, float offset_x, float offset_y,
-                                    float death_timer) {
-        if (!part_ent.has_value())
+    // The assembled parts hang off an anchor at the formation centre; dying
+    // parts are released so they stay where they fell.
+    if (!controller.formation_anchor.has_value() || !reg.is_alive(controller.formation_anchor.value())) {
+        entity anchor = reg.spawn_entity();
+        reg.add_component(anchor, position{});
+        controller.formation_anchor = anchor;
+    }
+    entity anchor = controller.formation_anchor.value();
+    *positions.find(anchor.id()) = position{target_x + oscillation_x, target_y + oscillation_y};
+
+    auto& links = reg.get_components<transform_link>();
+    auto link_part = [&](std::optional<entity>& part_ent, float offset_x, float offset_y,
+                         float death_timer) {
+        if (!part_ent.has_value() || !reg.is_alive(part_ent.value()))
             return;
-        if (death_timer >= 0.0f)
+        bool linked = links.contains(part_ent->id());
+        if (death_timer >= 0.0f) {
+            if (linked)
+                reg.remove_component<transform_link>(part_ent.value());
             return;
-        std::size_t idx = static_cast<std::size_t>(part_ent.value());
-        if (idx < positions.size() && positions[idx].has_value()) {
-            auto& pos = positions[idx].value();
-            pos.x = target_x + offset_x + oscillation_x;
-            pos.y = target_y + offset_y + oscillation_y;
         }
+        if (!linked)
+            reg.add_component(part_ent.value(), transform_link{anchor, offset_x, offset_y});
     };
 
-    update_part_position(controller.part1_entity, -50.0f, -40.0f, controller.part1_death_timer);
-    update_part_position(controller.part2_entity, 0.0f, 60.0f, controller.part2_death_timer);
-    update_part_position(controller.part3_entity, 70.0f, -40.0f, controller.part3_death_timer);
+    link_part(controller.part1_entity, -50.0f, -40.0f, controller.part1_death_timer);
+    link_part(controller.part2_entity, 0.0f, 60.0f, controller.part2_death_timer);
+    link_part(controller.part3_entity, 70.0f, -40.0f, controller.part3_death_timer);
+    transforms_.update(reg);
 
     controller.special_attack_timer += dt;
 
@@ -1902,6 +1868,10 @@ void BossManager::update_compiler_assembled(
     if (controller.state_timer >= controller.assembled_duration) {
         controller.state = CompilerState::Splitting;
         controller.state_timer = 0.0f;
+        for (auto* part : {&controller.part1_entity, &controller.part2_entity, &controller.part3_entity}) {
+            if (part->has_value())
+                reg.remove_component<transform_link>(part->value());
+        }
 
         auto& pos_components = reg.get_components<position>();
         for (std::size_t i = 0; i < controllers.size(); ++i) {
@@ -2197,14 +2167,14 @@ void BossManager::set_compiler_separated_targets(compiler_boss_controller& contr
 std::pair<int, int> BossManager::get_boss_health(registry& reg, std::optional<entity>& boss_entity,
                                                  std::optional<entity>& serpent_controller) {
     if (boss_entity.has_value()) {
-        auto& health_opt = reg.get_component<health>(boss_entity.value());
+        auto health_opt = reg.get_component<health>(boss_entity.value());
         if (health_opt.has_value()) {
             return {health_opt->current, health_opt->maximum};
         }
     }
 
     if (serpent_controller.has_value()) {
-        auto& ctrl_opt = reg.get_component<serpent_boss_controller>(serpent_controller.value());
+        auto ctrl_opt = reg.get_component<serpent_boss_controller>(serpent_controller.value());
         if (ctrl_opt.has_value()) {
             return {ctrl_opt->current_health, ctrl_opt->total_health};
         }
@@ -2227,16 +2197,16 @@ void BossManager::spawn_boss_explosions(registry& reg, float x, float y, int cou
     float zone_y = 150.0f + (static_cast<float>(count) * 2.0f);
     std::uniform_real_distribution<float> offset_x_dist(-zone_x, zone_x);
     std::uniform_real_distribution<float> offset_y_dist(-zone_y, zone_y);
+
+    static const prefab<position, entity_tag, explosion_tag> burst_explosion{
+        position{}, entity_tag{RType::EntityType::CompilerExplosion}, explosion_tag{0.5f}};
+    burst_explosion.reserve(reg, static_cast<std::size_t>(count));
+    despawn_schedule& despawns = despawn_schedule_of(reg);
     for (int i = 0; i < count; ++i) {
-        entity explosion = reg.spawn_entity();
         float exp_x = x + offset_x_dist(gen);
         float exp_y = y + offset_y_dist(gen);
-        float duration = 1.0f;
-        reg.add_component(explosion, position{exp_x, exp_y});
-        reg.add_component(explosion, entity_tag{RType::EntityType::CompilerExplosion});
-        explosion_tag exp_tag(duration);
-        exp_tag.elapsed = 0.0f;
-        reg.add_component(explosion, exp_tag);
+        entity explosion = burst_explosion.instantiate(reg, position{exp_x, exp_y});
+        despawns.expire_after(explosion, burst_explosion.get<explosion_tag>().lifetime);
     }
 }
 
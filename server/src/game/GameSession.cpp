@@ -50,16 +50,24 @@ GameSession::GameSession() {
     reg.register_component<explosive_projectile>();
     reg.register_component<game_settings>();
 
+    // Enemies shoot after moving, so their fire shares a stage with the
+    // explosive projectiles (see test_system_schedule.cpp).
     _engine.register_system(std::make_unique<ShootingSystem>());
-    _engine.register_system(std::make_unique<EnemyShootingSystem>());
     _engine.register_system(std::make_unique<WaveSystem>());
     _engine.register_system(std::make_unique<MovementSystem>());
+    _engine.register_system(std::make_unique<EnemyShootingSystem>(&_player_targets));
     _engine.register_system(std::make_unique<ExplosiveProjectileSystem>());
     _engine.register_system(std::make_unique<CollisionSystem>());
     _engine.register_system(std::make_unique<CleanupSystem>());
+    _engine.set_thread_pool(&engine::ThreadPool::shared());
 
     _engine.init();
 
+    // Pre-size the pools hit hardest by boss fights so the first volleys and
+    // death bursts fill reserved slots instead of growing the pools mid-fight.
+    reserveEnemyProjectiles(reg, 256);
+    reserveExplosions(reg, 64);
+
     auto level_mgr_entity = reg.spawn_entity();
     reg.emplace_component<level_manager>(level_mgr_entity);
 }
@@ -296,7 +304,7 @@ void GameSession::send_game_state_to_client(UDPServer& server, int client_id) {
         _player_manager.get_player_entity(_engine.get_registry(), _client_entity_ids, client_id);
     if (player_opt.has_value()) {
         auto player = player_opt.value();
-        auto& powerups_opt =
+        auto powerups_opt =
             _engine.get_registry().get_component<player_powerups_component>(player);
         if (powerups_opt.has_value()) {
             _powerup_broadcaster.broadcast_activable_slots(server, client_id,
@@ -331,7 +339,7 @@ void GameSession::process_network_events(UDPServer& server) {
 
             RType::OpCode opcode;
             deserializer >> opcode;
-            int client_id = server.register_client(packet.sender);
+            int client_id = packet.client_id;
 
             switch (opcode) {
                 case RType::OpCode::Input: {
@@ -500,7 +508,7 @@ void GameSession::process_network_events(UDPServer& server) {
                             server, _engine.get_registry(), _client_entity_ids, {client_id});
 
                         auto player = player_opt.value();
-                        auto& powerups_opt =
+                        auto powerups_opt =
                             _engine.get_registry().get_component<player_powerups_component>(player);
                         if (powerups_opt.has_value()) {
                             _powerup_broadcaster.broadcast_activable_slots(
@@ -615,11 +623,14 @@ void GameSession::update_game_state(UDPServer& server, float dt) {
         update_custom_level(dt);
     }
 
+    _player_targets.refresh(_engine.get_registry());
     _engine.update(dt);
+    // Players moved and may have been knocked out during the systems.
+    _player_targets.refresh(_engine.get_registry());
 
     if (!_is_custom_level) {
         _boss_manager.update_boss_behavior(
-            _engine.get_registry(), _boss_entity, _client_entity_ids, _boss_animation_timer,
+            _engine.get_registry(), _boss_entity, _player_targets, _boss_animation_timer,
             _boss_shoot_timer, _boss_shoot_cooldown, _boss_animation_complete,
             _boss_entrance_complete, _boss_target_x, _boss_shoot_counter, dt);
 
@@ -630,7 +641,7 @@ void GameSession::update_game_state(UDPServer& server, float dt) {
     _boss_manager.update_compiler_boss(_engine.get_registry(), _compiler_controller_entity,
                                        _client_entity_ids, dt);
 
-    _boss_manager.update_homing_enemies(_engine.get_registry(), _client_entity_ids, dt);
+    _boss_manager.update_homing_enemies(_engine.get_registry(), _player_targets, dt);
 
     auto& cannons = _engine.get_registry().get_components<power_cannon>();
     auto& shields = _engine.get_registry().get_components<shield>();
@@ -653,11 +664,13 @@ void GameSession::update_game_state(UDPServer& server, float dt) {
     for (std::size_t i = 0; i < laser_beams.size(); ++i) {
         if (laser_beams[i].has_value() && i < positions.size() && positions[i].has_value()) {
             auto& laser = laser_beams[i].value();
-            auto& player_pos = positions[i].value();
+            // Copied: spawning the beam entity below can reallocate the position pool.
+            const position player_pos = positions[i].value();
             laser.update(dt);
 
             if (laser.active) {
-                if (!laser.laser_entity.has_value()) {
+                if (!laser.laser_entity.has_value() ||
+                    !_engine.get_registry().is_alive(laser.laser_entity.value())) {
                     entity laser_ent = _engine.get_registry().spawn_entity();
 
                     _engine.get_registry().add_component(
@@ -666,7 +679,7 @@ void GameSession::update_game_state(UDPServer& server, float dt) {
                     _engine.get_registry().add_component(laser_ent, velocity{0.0f, 0.0f});
 
                     sprite_component sprite;
-                    sprite.texture_path = "assets/laserbeam.png";
+                    sprite.set_texture("assets/laserbeam.png");
                     sprite.texture_rect_x = 0;
                     sprite.texture_rect_y = 0;
                     sprite.texture_rect_w = 2000;
@@ -680,7 +693,7 @@ void GameSession::update_game_state(UDPServer& server, float dt) {
                     laser.laser_entity = laser_ent;
                 }
 
-                auto& laser_pos_opt =
+                auto laser_pos_opt =
                     _engine.get_registry().get_component<position>(laser.laser_entity.value());
                 if (laser_pos_opt.has_value()) {
                     laser_pos_opt->x = player_pos.x + 50.0f;
@@ -721,8 +734,13 @@ void GameSession::update_game_state(UDPServer& server, float dt) {
                                     }
                                 } else if (j < healths.size() && healths[j].has_value()) {
                                     auto& enemy_hp = healths[j].value();
+                                    const bool was_alive = enemy_hp.is_alive();
                                     enemy_hp.current -= damage;
-                                    
+
+                                    if (was_alive && enemy_hp.is_dead()) {
+                                        despawn_schedule_of(_engine.get_registry())
+                                            .flag_death(_engine.get_registry().entity_from_index(j));
+                                    }
                                     if (enemy_hp.is_dead()) {
                                         bool is_boss_part = (j < entity_tags.size() && entity_tags[j].has_value() &&
                                                             (entity_tags[j]->type == RType::EntityType::SerpentHoming ||
@@ -747,9 +765,7 @@ void GameSession::update_game_state(UDPServer& server, float dt) {
                 }
             } else {
                 if (laser.laser_entity.has_value()) {
-                    try {
-                        _engine.get_registry().kill_entity(laser.laser_entity.value());
-                    } catch (...) {}
+                    _engine.get_registry().kill_entity(laser.laser_entity.value());
                     laser.laser_entity = std::nullopt;
                 }
             }
@@ -765,17 +781,15 @@ void GameSession::update_game_state(UDPServer& server, float dt) {
     for (std::size_t i = 0; i < little_friends.size(); ++i) {
         if (little_friends[i].has_value() && i < positions.size() && positions[i].has_value()) {
             auto& lf = little_friends[i].value();
-            auto& player_pos = positions[i].value();
+            const position player_pos = positions[i].value();
             lf.update(dt);
 
             if (lf.is_active()) {
                 if (lf.friend_entities.size() != static_cast<size_t>(lf.num_drones)) {
                     while (lf.friend_entities.size() > static_cast<size_t>(lf.num_drones)) {
                         if (lf.friend_entities.back().has_value()) {
-                            try {
-                                _engine.get_registry().kill_entity(
-                                    lf.friend_entities.back().value());
-                            } catch (...) {}
+                            _engine.get_registry().kill_entity(
+                                lf.friend_entities.back().value());
                         }
                         lf.friend_entities.pop_back();
                     }
@@ -786,7 +800,8 @@ void GameSession::update_game_state(UDPServer& server, float dt) {
 
                 for (std::size_t drone_idx = 0; drone_idx < static_cast<std::size_t>(lf.num_drones);
                      ++drone_idx) {
-                    if (!lf.friend_entities[drone_idx].has_value()) {
+                    if (!lf.friend_entities[drone_idx].has_value() ||
+                        !_engine.get_registry().is_alive(lf.friend_entities[drone_idx].value())) {
                         entity friend_ent = _engine.get_registry().spawn_entity();
 
                         _engine.get_registry().add_component(
@@ -795,7 +810,7 @@ void GameSession::update_game_state(UDPServer& server, float dt) {
                         _engine.get_registry().add_component(friend_ent, velocity{0.0f, 0.0f});
 
                         sprite_component sprite;
-                        sprite.texture_path = "assets/r-typesheet5.gif";
+                        sprite.set_texture("assets/r-typesheet5.gif");
                         sprite.texture_rect_x = 495;
                         sprite.texture_rect_y = 0;
                         sprite.texture_rect_w = 33;
@@ -819,11 +834,11 @@ void GameSession::update_game_state(UDPServer& server, float dt) {
                         continue;
                     }
 
-                    auto& friend_pos_opt = _engine.get_registry().get_component<position>(
+                    auto friend_pos_opt = _engine.get_registry().get_component<position>(
                         lf.friend_entities[drone_idx].value());
-                    auto& friend_vel_opt = _engine.get_registry().get_component<velocity>(
+                    auto friend_vel_opt = _engine.get_registry().get_component<velocity>(
                         lf.friend_entities[drone_idx].value());
-                    auto& friend_sprite_opt =
+                    auto friend_sprite_opt =
                         _engine.get_registry().get_component<sprite_component>(
                             lf.friend_entities[drone_idx].value());
 
@@ -969,11 +984,9 @@ void GameSession::update_game_state(UDPServer& server, float dt) {
             if (!lf.is_active()) {
                 for (auto& friend_entity_opt : lf.friend_entities) {
                     if (friend_entity_opt.has_value()) {
-                        try {
-                            _engine.get_registry().kill_entity(friend_entity_opt.value());
-                            std::cout << "[LittleFriend] Despawned ally ship for player " << i
-                                      << std::endl;
-                        } catch (...) {}
+                        _engine.get_registry().kill_entity(friend_entity_opt.value());
+                        std::cout << "[LittleFriend] Despawned ally ship for player " << i
+                                  << std::endl;
                         friend_entity_opt = std::nullopt;
                     }
                 }
@@ -986,17 +999,15 @@ void GameSession::update_game_state(UDPServer& server, float dt) {
     for (std::size_t i = 0; i < missile_drones.size(); ++i) {
         if (missile_drones[i].has_value() && i < positions.size() && positions[i].has_value()) {
             auto& md = missile_drones[i].value();
-            auto& player_pos = positions[i].value();
+            const position player_pos = positions[i].value();
             md.update(dt);
 
             if (md.is_active()) {
                 if (md.drone_entities.size() != static_cast<size_t>(md.num_drones)) {
                     while (md.drone_entities.size() > static_cast<size_t>(md.num_drones)) {
                         if (md.drone_entities.back().has_value()) {
-                            try {
-                                _engine.get_registry().kill_entity(
-                                    md.drone_entities.back().value());
-                            } catch (...) {}
+                            _engine.get_registry().kill_entity(
+                                md.drone_entities.back().value());
                         }
                         md.drone_entities.pop_back();
                     }
@@ -1007,7 +1018,8 @@ void GameSession::update_game_state(UDPServer& server, float dt) {
 
                 for (std::size_t drone_idx = 0; drone_idx < static_cast<std::size_t>(md.num_drones);
                      ++drone_idx) {
-                    if (!md.drone_entities[drone_idx].has_value()) {
+                    if (!md.drone_entities[drone_idx].has_value() ||
+                        !_engine.get_registry().is_alive(md.drone_entities[drone_idx].value())) {
                         entity drone_ent = _engine.get_registry().spawn_entity();
 
                         _engine.get_registry().add_component(
@@ -1016,7 +1028,7 @@ void GameSession::update_game_state(UDPServer& server, float dt) {
                         _engine.get_registry().add_component(drone_ent, velocity{0.0f, 0.0f});
 
                         sprite_component sprite;
-                        sprite.texture_path = "assets/r-typesheet5.gif";
+                        sprite.set_texture("assets/r-typesheet5.gif");
                         sprite.texture_rect_x = 495;
                         sprite.texture_rect_y = 0;
                         sprite.texture_rect_w = 33;
@@ -1031,7 +1043,7 @@ void GameSession::update_game_state(UDPServer& server, float dt) {
                         md.drone_entities[drone_idx] = drone_ent;
                     }
 
-                    auto& drone_pos_opt = _engine.get_registry().get_component<position>(
+                    auto drone_pos_opt = _engine.get_registry().get_component<position>(
                         md.drone_entities[drone_idx].value());
 
                     if (drone_pos_opt.has_value()) {
@@ -1068,7 +1080,7 @@ void GameSession::update_game_state(UDPServer& server, float dt) {
                     for (std::size_t drone_idx = 0;
                          drone_idx < static_cast<std::size_t>(md.num_drones); ++drone_idx) {
                         if (md.drone_entities[drone_idx].has_value()) {
-                            auto& drone_pos_opt = _engine.get_registry().get_component<position>(
+                            auto drone_pos_opt = _engine.get_registry().get_component<position>(
                                 md.drone_entities[drone_idx].value());
 
                             if (drone_pos_opt.has_value()) {
@@ -1136,9 +1148,7 @@ void GameSession::update_game_state(UDPServer& server, float dt) {
             } else {
                 for (auto& drone_entity_opt : md.drone_entities) {
                     if (drone_entity_opt.has_value()) {
-                        try {
-                            _engine.get_registry().kill_entity(drone_entity_opt.value());
-                        } catch (...) {}
+                        _engine.get_registry().kill_entity(drone_entity_opt.value());
                         drone_entity_opt = std::nullopt;
                     }
                 }
@@ -1153,14 +1163,6 @@ void GameSession::update_game_state(UDPServer& server, float dt) {
             damage_flashes[i]->update(dt);
         }
     }
-
-    auto& explosion_tags = _engine.get_registry().get_components<explosion_tag>();
-
-    for (std::size_t i = 0; i < explosion_tags.size(); ++i) {
-        if (explosion_tags[i].has_value()) {
-            explosion_tags[i].value().elapsed += dt;
-        }
-    }
 }
 
 void GameSession::send_periodic_updates(UDPServer& server, float dt) {
@@ -1201,7 +1203,7 @@ void GameSession::send_periodic_updates(UDPServer& server, float dt) {
 
             for (const auto& [client_id, entity_id] : _client_entity_ids) {
                 auto player = _engine.get_registry().entity_from_index(entity_id);
-                auto& powerups_opt =
+                auto powerups_opt =
                     _engine.get_registry().get_component<player_powerups_component>(player);
                 if (powerups_opt.has_value()) {
                     _powerup_broadcaster.broadcast_activable_slots(server, client_id,
@@ -1363,11 +1365,9 @@ void GameSession::reset_game([[maybe_unused]] UDPServer& server) {
     _powerup_choice_timer = 0.0f;
 
     if (_boss_entity.has_value()) {
-        try {
-            auto boss_entity = _boss_entity.value();
-            _engine.get_registry().remove_component<entity_tag>(boss_entity);
-            _engine.get_registry().kill_entity(boss_entity);
-        } catch (...) {}
+        auto boss_entity = _boss_entity.value();
+        _engine.get_registry().remove_component<entity_tag>(boss_entity);
+        _engine.get_registry().kill_entity(boss_entity);
     }
     _boss_entity = std::nullopt;
     _boss_animation_timer = 0.0f;
@@ -1450,9 +1450,7 @@ void GameSession::remove_player(int client_id) {
             auto& lf = little_friends[it->second].value();
             for (auto& friend_entity_opt : lf.friend_entities) {
                 if (friend_entity_opt.has_value()) {
-                    try {
-                        _engine.get_registry().kill_entity(friend_entity_opt.value());
-                    } catch (...) {}
+                    _engine.get_registry().kill_entity(friend_entity_opt.value());
                 }
             }
         }
@@ -1461,9 +1459,7 @@ void GameSession::remove_player(int client_id) {
             auto& md = missile_drones[it->second].value();
             for (auto& drone_entity_opt : md.drone_entities) {
                 if (drone_entity_opt.has_value()) {
-                    try {
-                        _engine.get_registry().kill_entity(drone_entity_opt.value());
-                    } catch (...) {}
+                    _engine.get_registry().kill_entity(drone_entity_opt.value());
                 }
             }
         }
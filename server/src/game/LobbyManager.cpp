@@ -93,6 +93,37 @@ std::vector<LobbyInfo> LobbyManager::get_lobby_list() {
     return list;
 }
 
+std::vector<LobbyStats> LobbyManager::get_lobby_stats() {
+    std::lock_guard<std::mutex> lock(_lobbies_mutex);
+
+    std::vector<LobbyStats> stats;
+    for (const auto& [id, lobby] : _lobbies) {
+        GameSession* session = lobby->get_game_session();
+        if (!session) {
+            continue;
+        }
+
+        LobbyStats entry;
+        entry.lobby_id = lobby->get_id();
+        entry.name = lobby->get_name();
+        entry.entities = session->getRegistry().alive_count();
+        entry.systems = session->getEngine().get_system_stats();
+        stats.push_back(std::move(entry));
+    }
+
+    return stats;
+}
+
+bool LobbyManager::write_lobby_trace(int lobby_id, const std::string& path) {
+    std::lock_guard<std::mutex> lock(_lobbies_mutex);
+
+    auto it = _lobbies.find(lobby_id);
+    if (it == _lobbies.end() || !it->second->get_game_session()) {
+        return false;
+    }
+    return it->second->get_game_session()->getEngine().write_chrome_trace(path);
+}
+
 bool LobbyManager::join_lobby(int lobby_id, int client_id, UDPServer& server) {
     leave_lobby(client_id, server);
 
@@ -71,7 +71,7 @@ void PlayerManager::respawn_dead_players(registry& reg,
         auto health_opt = reg.get_component<health>(player);
 
         if (health_opt.has_value() && health_opt->current <= 0) {
-            auto& pos_opt = reg.get_component<position>(player);
+            auto pos_opt = reg.get_component<position>(player);
             if (pos_opt.has_value()) {
                 float start_x = 100.0f + (static_cast<float>(client_id) * 50.0f);
                 float start_y = 300.0f;
@@ -79,29 +79,29 @@ void PlayerManager::respawn_dead_players(registry& reg,
                 pos_opt->y = start_y;
             }
 
-            auto& vel_opt = reg.get_component<velocity>(player);
+            auto vel_opt = reg.get_component<velocity>(player);
             if (vel_opt.has_value()) {
                 vel_opt->vx = 0.0f;
                 vel_opt->vy = 0.0f;
             }
 
-            auto& controllable_opt = reg.get_component<controllable>(player);
+            auto controllable_opt = reg.get_component<controllable>(player);
             if (controllable_opt.has_value()) {
                 controllable_opt->speed = 300.0f;
             }
 
-            auto& collision_opt = reg.get_component<collision_box>(player);
+            auto collision_opt = reg.get_component<collision_box>(player);
             if (collision_opt.has_value()) {
                 collision_opt->enabled = true;
             }
 
-            auto& sprite_opt = reg.get_component<sprite_component>(player);
+            auto sprite_opt = reg.get_component<sprite_component>(player);
             if (sprite_opt.has_value()) {
                 sprite_opt->visible = true;
             }
 
             auto& all_healths = reg.get_components<health>();
-            auto& player_health_ref = all_healths[entity_id];
+            auto player_health_ref = all_healths[entity_id];
             if (player_health_ref.has_value()) {
                 player_health_ref->current = player_health_ref->maximum;
             }
@@ -30,8 +30,15 @@ ServerCore::ServerCore()
 }
 
 void ServerCore::process_network_events(UDPServer& server) {
-    NetworkPacket packet;
-    while (server.get_input_packet(packet)) {
+    uint64_t dropped = server.get_input_dropped_count();
+    if (dropped != _reported_input_drops) {
+        std::cerr << "[ServerCore] Input queue full, dropped " << (dropped - _reported_input_drops)
+                  << " packets" << std::endl;
+        _reported_input_drops = dropped;
+    }
+
+    server.get_input_packets(_input_batch);
+    for (NetworkPacket& packet : _input_batch) {
         if (packet.data.empty() || packet.data.size() < 3) {
             continue;
         }
@@ -54,7 +61,7 @@ void ServerCore::process_network_events(UDPServer& server) {
 
             RType::OpCode opcode;
             deserializer >> opcode;
-            int client_id = server.register_client(packet.sender);
+            int client_id = packet.client_id;
 
             switch (opcode) {
                 case RType::OpCode::Login: {
@@ -224,6 +231,7 @@ void ServerCore::run_game_loop(UDPServer& server) {
         process_network_events(server);
         update_lobbies(server, dt);
         periodic_cleanup(server, dt);
+        server.flush_output();
         auto frame_time = std::chrono::steady_clock::now() - current_time;
         auto target_frame_time = std::chrono::duration<float>(target_dt);
         if (frame_time < target_frame_time) {
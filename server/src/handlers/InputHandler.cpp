@@ -66,10 +66,10 @@ void InputHandler::apply_buffered_inputs(
 }
 
 void InputHandler::apply_input_to_player(registry& reg, entity player, uint8_t input_mask) {
-    auto& pos_opt = reg.get_component<position>(player);
-    auto& vel_opt = reg.get_component<velocity>(player);
-    auto& wpn_opt = reg.get_component<weapon>(player);
-    auto& power_cannon_opt = reg.get_component<power_cannon>(player);
+    auto pos_opt = reg.get_component<position>(player);
+    auto vel_opt = reg.get_component<velocity>(player);
+    auto wpn_opt = reg.get_component<weapon>(player);
+    auto power_cannon_opt = reg.get_component<power_cannon>(player);
 
     if (pos_opt.has_value() && vel_opt.has_value()) {
         vel_opt->vx = 0.0f;
@@ -97,7 +97,7 @@ void InputHandler::apply_input_to_player(registry& reg, entity player, uint8_t i
                         visual_type = WeaponUpgradeType::PowerShot;
                     }
 
-                    auto& multishot_opt = reg.get_component<multishot>(player);
+                    auto multishot_opt = reg.get_component<multishot>(player);
                     int total_projectiles =
                         multishot_opt.has_value() ? multishot_opt->extra_projectiles : 1;
 
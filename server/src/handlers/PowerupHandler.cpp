@@ -33,7 +33,7 @@ std::vector<powerup::PowerupCard> PowerupHandler::generate_card_choices(
 
     auto player = player_opt.value();
 
-    auto& powerups_opt = reg.get_component<player_powerups_component>(player);
+    auto powerups_opt = reg.get_component<player_powerups_component>(player);
     if (!powerups_opt.has_value()) {
         reg.emplace_component<player_powerups_component>(player);
     }
@@ -59,7 +59,7 @@ void PowerupHandler::handle_powerup_choice(
 
     auto player = player_opt.value();
 
-    auto& powerups_opt = reg.get_component<player_powerups_component>(player);
+    auto powerups_opt = reg.get_component<player_powerups_component>(player);
     if (!powerups_opt.has_value()) {
         reg.emplace_component<player_powerups_component>(player);
     }
@@ -126,7 +126,7 @@ void PowerupHandler::handle_powerup_activate(
     }
     auto player = player_opt.value();
 
-    auto& powerups_opt = reg.get_component<player_powerups_component>(player);
+    auto powerups_opt = reg.get_component<player_powerups_component>(player);
     if (!powerups_opt.has_value()) {
         return;
     }
@@ -162,7 +162,7 @@ void PowerupHandler::handle_powerup_activate(
             float duration = effect.duration;
             int damage = static_cast<int>(effect.value);
 
-            auto& cannon_opt = reg.get_component<power_cannon>(player);
+            auto cannon_opt = reg.get_component<power_cannon>(player);
             if (cannon_opt.has_value()) {
                 cannon_opt->activate(duration, damage);
             } else {
@@ -176,7 +176,7 @@ void PowerupHandler::handle_powerup_activate(
             float duration = effect.duration;
             float radius = effect.value;
 
-            auto& shield_opt = reg.get_component<shield>(player);
+            auto shield_opt = reg.get_component<shield>(player);
             if (shield_opt.has_value()) {
                 shield_opt->activate(duration, radius);
             } else {
@@ -190,7 +190,7 @@ void PowerupHandler::handle_powerup_activate(
             float duration = effect.duration;
             float dps = effect.value;
 
-            auto& laser_opt = reg.get_component<laser_beam>(player);
+            auto laser_opt = reg.get_component<laser_beam>(player);
             if (laser_opt.has_value()) {
                 laser_opt->max_duration = duration;
                 laser_opt->damage_per_second = dps;
@@ -209,7 +209,7 @@ void PowerupHandler::handle_powerup_activate(
 void PowerupHandler::apply_passive_powerup(registry& reg, entity player, powerup::PowerupId id,
                                            uint8_t level) {
     if (id == powerup::PowerupId::LittleFriend) {
-        auto& friend_opt = reg.get_component<little_friend>(player);
+        auto friend_opt = reg.get_component<little_friend>(player);
         if (!friend_opt.has_value()) {
             reg.emplace_component<little_friend>(player);
         }
@@ -231,7 +231,7 @@ void PowerupHandler::apply_passive_powerup(registry& reg, entity player, powerup
         std::cout << "[Game] Little Friend passive activated at level " << static_cast<int>(level)
                   << " with " << lf.num_drones << " drone(s)" << std::endl;
     } else if (id == powerup::PowerupId::MissileDrone) {
-        auto& drone_opt = reg.get_component<missile_drone>(player);
+        auto drone_opt = reg.get_component<missile_drone>(player);
         if (!drone_opt.has_value()) {
             reg.emplace_component<missile_drone>(player);
         }
@@ -263,21 +263,21 @@ void PowerupHandler::apply_stat_powerup(registry& reg, entity player, powerup::P
     const auto& effect = def->level_effects[level - 1];
 
     if (id == powerup::PowerupId::Damage) {
-        auto& weapon_opt = reg.get_component<weapon>(player);
+        auto weapon_opt = reg.get_component<weapon>(player);
         if (weapon_opt.has_value()) {
             float base_damage = 10.0f;
             weapon_opt->damage = static_cast<int>(base_damage * effect.value);
             std::cout << "[Game] Damage increased to " << weapon_opt->damage << std::endl;
         }
     } else if (id == powerup::PowerupId::Speed) {
-        auto& control_opt = reg.get_component<controllable>(player);
+        auto control_opt = reg.get_component<controllable>(player);
         if (control_opt.has_value()) {
             float base_speed = 200.0f;
             control_opt->speed = base_speed * effect.value;
             std::cout << "[Game] Speed increased to " << control_opt->speed << std::endl;
         }
     } else if (id == powerup::PowerupId::Health) {
-        auto& health_opt = reg.get_component<health>(player);
+        auto health_opt = reg.get_component<health>(player);
         if (health_opt.has_value()) {
             int bonus = static_cast<int>(effect.value);
             health_opt->maximum += bonus;
@@ -286,7 +286,7 @@ void PowerupHandler::apply_stat_powerup(registry& reg, entity player, powerup::P
                       << std::endl;
         }
     } else if (id == powerup::PowerupId::FireRate) {
-        auto& weapon_opt = reg.get_component<weapon>(player);
+        auto weapon_opt = reg.get_component<weapon>(player);
         if (weapon_opt.has_value()) {
             float base_fire_rate = 1.8f;
             weapon_opt->fire_rate = base_fire_rate * effect.value;
@@ -294,7 +294,7 @@ void PowerupHandler::apply_stat_powerup(registry& reg, entity player, powerup::P
                       << "% (new rate: " << weapon_opt->fire_rate << " shots/s)" << std::endl;
         }
     } else if (id == powerup::PowerupId::MultiShot) {
-        auto& multishot_opt = reg.get_component<multishot>(player);
+        auto multishot_opt = reg.get_component<multishot>(player);
         if (!multishot_opt.has_value()) {
             reg.emplace_component<multishot>(player, static_cast<int>(effect.value));
         } else {
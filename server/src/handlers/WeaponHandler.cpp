@@ -21,7 +21,7 @@ bool WeaponHandler::handle_weapon_upgrade_choice(
         return false;
     }
     auto player = player_opt.value();
-    auto& wpn_opt = reg.get_component<weapon>(player);
+    auto wpn_opt = reg.get_component<weapon>(player);
     if (!wpn_opt.has_value()) {
         std::cerr << "[Game] Cannot apply upgrade: player has no weapon component" << std::endl;
         return false;
@@ -4,6 +4,7 @@
 
 #include <csignal>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <iostream>
@@ -50,6 +51,7 @@ int main(int argc, char** argv) {
 
     std::string bind_address = "127.0.0.1";
     unsigned short port = 4242;
+    std::size_t socket_shards = 1;
 
     for (int i = 1; i < argc; ++i) {
         std::string arg = argv[i];
@@ -62,6 +64,13 @@ int main(int argc, char** argv) {
                 std::cerr << "[Error] Invalid port specified, using default 4242" << std::endl;
                 port = 4242;
             }
+        } else if (arg == "-s" && i + 1 < argc) {
+            try {
+                socket_shards = std::max<std::size_t>(std::stoul(argv[++i]), 1);
+            } catch (...) {
+                std::cerr << "[Error] Invalid socket count specified, using 1" << std::endl;
+                socket_shards = 1;
+            }
         } else {
             std::cerr << "[Error] Unknown argument: " << arg << std::endl;
         }
@@ -72,13 +81,14 @@ int main(int argc, char** argv) {
     std::cout << "==============================" << std::endl;
     std::cout << "[Config] Bind address: " << bind_address << std::endl;
     std::cout << "[Config] Port: " << port << std::endl;
+    std::cout << "[Config] Sockets: " << socket_shards << std::endl;
 
     std::cout << "[Init] Initializing power-up system..." << std::endl;
     powerup::PowerupRegistry::instance().initialize();
 
     try {
         asio::io_context io_context;
-        server::UDPServer server(io_context, bind_address, port);
+        server::UDPServer server(io_context, bind_address, port, socket_shards);
 
         std::thread network_thread(network_loop, std::ref(server));
         std::thread game_thread(game_loop, std::ref(server));
@@ -63,9 +63,8 @@ void EntityBroadcaster::broadcast_entity_positions(
         }
     }
 
-    for (size_t i = 0; i < tags.size(); ++i) {
-        if (!tags[i].has_value())
-            continue;
+    for (size_t d = 0; d < tags.dense_size(); ++d) {
+        size_t i = tags.dense_index(d);
         if (i >= positions.size() || !positions[i].has_value())
             continue;
 
@@ -106,7 +105,7 @@ void EntityBroadcaster::broadcast_entity_positions(
                 tags[i]->type == RType::EntityType::CustomProjectile) {
                 auto custom_id_opt = reg.get_component<custom_entity_id>(entity_obj);
                 std::string entity_id_str =
-                    custom_id_opt.has_value() ? custom_id_opt->entity_id : "";
+                    custom_id_opt.has_value() ? custom_id_opt->id() : "";
 
                 uint8_t id_length =
                     static_cast<uint8_t>(std::min(entity_id_str.length(), size_t(255)));
@@ -217,9 +216,8 @@ void EntityBroadcaster::send_full_game_state_to_client(
         }
     }
 
-    for (size_t i = 0; i < tags.size(); ++i) {
-        if (!tags[i].has_value())
-            continue;
+    for (size_t d = 0; d < tags.dense_size(); ++d) {
+        size_t i = tags.dense_index(d);
         if (i >= positions.size() || !positions[i].has_value())
             continue;
 
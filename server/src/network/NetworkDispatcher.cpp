@@ -41,7 +41,7 @@ std::unique_ptr<INetworkCommand> NetworkDispatcher::parse_packet(const NetworkPa
         RType::OpCode opcode;
         deserializer >> opcode;
 
-        int client_id = server.register_client(packet.sender);
+        int client_id = server.register_client(packet.sender).client_id;
 
         std::cerr << "[NetworkDispatcher] Opcode parsing not yet implemented: "
                   << static_cast<int>(opcode) << std::endl;
@@ -38,7 +38,7 @@ void PowerupBroadcaster::broadcast_powerup_status(
     for (const auto& [client_id, entity_id] : client_entity_ids) {
         auto player = reg.entity_from_index(entity_id);
 
-        auto& cannon_opt = reg.get_component<power_cannon>(player);
+        auto cannon_opt = reg.get_component<power_cannon>(player);
         if (cannon_opt.has_value()) {
             uint8_t powerup_type = 1;
             float time_remaining = 0.0f;
@@ -55,7 +55,7 @@ void PowerupBroadcaster::broadcast_powerup_status(
             server.send_to_clients(lobby_client_ids, serializer.data());
         }
 
-        auto& shield_opt = reg.get_component<shield>(player);
+        auto shield_opt = reg.get_component<shield>(player);
         if (shield_opt.has_value()) {
             uint8_t powerup_type = 2;
             float time_remaining = 0.0f;
@@ -2,25 +2,21 @@
 
 #include "../../src/Common/CompressionSerializer.hpp"
 
+#include <algorithm>
+#include <cerrno>
 #include <cstring>
 
 #include <iostream>
 
+#ifdef __linux__
+#include <sys/socket.h>
+#endif
+
 namespace server {
 
 UDPServer::UDPServer(asio::io_context& io_context, const std::string& bind_address,
-                     unsigned short port)
+                     unsigned short port, std::size_t socket_shards)
     : io_context_(io_context), next_client_id_(1), running_(true) {
-    try {
-        recv_buffer_ = std::make_unique<std::vector<uint8_t>>(65536);
-    } catch (const std::exception& e) {
-        std::cerr << "[Error] Failed to allocate recv_buffer: " << e.what() << std::endl;
-        throw;
-    } catch (...) {
-        std::cerr << "[Error] Unknown error allocating recv_buffer" << std::endl;
-        throw;
-    }
-
     try {
         work_guard_ = std::make_unique<asio::executor_work_guard<asio::io_context::executor_type>>(
             io_context.get_executor());
@@ -32,30 +28,98 @@ UDPServer::UDPServer(asio::io_context& io_context, const std::string& bind_addre
         throw;
     }
 
+#ifndef __linux__
+    if (socket_shards > 1) {
+        std::cerr << "[Network] SO_REUSEPORT sharding is Linux only, using one socket" << std::endl;
+        socket_shards = 1;
+    }
+#endif
+    socket_shards = std::max<std::size_t>(socket_shards, 1);
+    const bool reuse_port = socket_shards > 1;
+
+    for (std::size_t i = 0; i < socket_shards; ++i) {
+        auto shard = std::make_unique<SocketShard>();
+        shard->index = i;
+        if (i == 0) {
+            shard->context = &io_context_;
+        } else {
+            shard->owned_context = std::make_unique<asio::io_context>();
+            shard->context = shard->owned_context.get();
+        }
+        shard->socket = open_socket(*shard->context, bind_address, port, reuse_port);
+        // With port 0 the first bind picks the port; the other shards join it.
+        port = shard->socket->local_endpoint().port();
+        shards_.push_back(std::move(shard));
+    }
+    if (reuse_port) {
+        std::cout << "[Network] " << socket_shards << " sockets sharing port " << port
+                  << " (SO_REUSEPORT)" << std::endl;
+    }
+
+    for (auto& shard : shards_) {
+        start_receive(*shard);
+    }
+    for (std::size_t i = 1; i < shards_.size(); ++i) {
+        shards_[i]->thread = std::thread(&UDPServer::run_shard, this, std::ref(*shards_[i]));
+    }
+
+    retry_thread_ = std::thread(&UDPServer::retry_thread_loop, this);
+}
+
+UDPServer::~UDPServer() {
+    stop();
+
+    for (auto& shard : shards_) {
+        if (shard->thread.joinable()) {
+            shard->thread.join();
+        }
+    }
+    if (retry_thread_.joinable()) {
+        retry_thread_.join();
+    }
+}
+
+std::unique_ptr<asio::ip::udp::socket> UDPServer::open_socket(asio::io_context& context,
+                                                              const std::string& bind_address,
+                                                              unsigned short port,
+                                                              bool reuse_port) {
     try {
-        socket_ = std::make_unique<asio::ip::udp::socket>(io_context);
+        auto socket = std::make_unique<asio::ip::udp::socket>(context);
+
+        auto open = [&](const asio::ip::udp& protocol) {
+            socket->open(protocol);
+#ifdef __linux__
+            if (reuse_port) {
+                using reuse_port_option = asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>;
+                socket->set_option(reuse_port_option(true));
+            }
+#else
+            (void)reuse_port;
+#endif
+        };
 
         if (bind_address.empty()) {
-            socket_->open(asio::ip::udp::v6());
-            socket_->set_option(asio::ip::v6_only(false));
-            socket_->bind(asio::ip::udp::endpoint(asio::ip::udp::v6(), port));
+            open(asio::ip::udp::v6());
+            socket->set_option(asio::ip::v6_only(false));
+            socket->bind(asio::ip::udp::endpoint(asio::ip::udp::v6(), port));
             std::cout << "[Network] UDP Server listening on port " << port << " (Dual Stack)"
                       << std::endl;
         } else {
             asio::ip::address addr = asio::ip::make_address(bind_address);
             if (addr.is_v6()) {
-                socket_->open(asio::ip::udp::v6());
-                socket_->set_option(asio::ip::v6_only(false));
-                socket_->bind(asio::ip::udp::endpoint(addr, port));
+                open(asio::ip::udp::v6());
+                socket->set_option(asio::ip::v6_only(false));
+                socket->bind(asio::ip::udp::endpoint(addr, port));
                 std::cout << "[Network] UDP Server listening on " << bind_address << ":" << port
                           << " (IPv6 / dual-stack)" << std::endl;
             } else {
-                socket_->open(asio::ip::udp::v4());
-                socket_->bind(asio::ip::udp::endpoint(addr, port));
+                open(asio::ip::udp::v4());
+                socket->bind(asio::ip::udp::endpoint(addr, port));
                 std::cout << "[Network] UDP Server listening on " << bind_address << ":" << port
                           << " (IPv4)" << std::endl;
             }
         }
+        return socket;
     } catch (const std::system_error& e) {
         std::cerr << "[Error] System error in socket creation/bind: " << e.what()
                   << " (code: " << e.code() << ")" << std::endl;
@@ -67,179 +131,362 @@ UDPServer::UDPServer(asio::io_context& io_context, const std::string& bind_addre
         std::cerr << "[Error] Unknown error in socket creation/bind" << std::endl;
         throw;
     }
+}
 
-    start_receive();
-
-    retry_thread_ = std::thread(&UDPServer::retry_thread_loop, this);
+#ifdef __linux__
+void UDPServer::start_receive(SocketShard& shard) {
+    shard.socket->async_wait(asio::ip::udp::socket::wait_read,
+                             [this, &shard](std::error_code ec) { drain_socket(shard, ec); });
 }
 
-UDPServer::~UDPServer() {
-    stop();
+void UDPServer::drain_socket(SocketShard& shard, std::error_code ec) {
+    if (ec) {
+        std::cerr << "[Error] Receive error: " << ec.message() << std::endl;
+        if (running_) {
+            start_receive(shard);
+        }
+        return;
+    }
 
-    if (retry_thread_.joinable()) {
-        retry_thread_.join();
+    std::array<std::span<uint8_t>, RECV_BATCH> slabs;
+    std::array<iovec, RECV_BATCH> iovecs{};
+    std::array<sockaddr_storage, RECV_BATCH> addresses{};
+    std::array<mmsghdr, RECV_BATCH> messages{};
+    for (std::size_t i = 0; i < RECV_BATCH; ++i) {
+        slabs[i] = shard.recv_pool.acquire();
+        iovecs[i].iov_base = slabs[i].data();
+        iovecs[i].iov_len = slabs[i].size();
+        messages[i].msg_hdr.msg_iov = &iovecs[i];
+        messages[i].msg_hdr.msg_iovlen = 1;
+        messages[i].msg_hdr.msg_name = &addresses[i];
     }
-}
 
-void UDPServer::start_receive() {
-    socket_->async_receive_from(
-        asio::buffer(*recv_buffer_), remote_endpoint_,
-        [this](std::error_code ec, std::size_t bytes_recvd) { handle_receive(ec, bytes_recvd); });
-}
-
-void UDPServer::handle_receive(std::error_code ec, std::size_t bytes_received) {
-    if (!ec && bytes_received > 0) {
-        if (bytes_received >= 2) {
-            std::vector<uint8_t> data(recv_buffer_->begin(),
-                                      recv_buffer_->begin() +
-                                          static_cast<std::ptrdiff_t>(bytes_received));
-
-            if (!data.empty() && (data[0] == 0x00 || data[0] == 0x01)) {
-                try {
-                    RType::CompressionSerializer decompressor(data);
-                    decompressor.decompress();
-                    data = decompressor.data();
-                } catch (const RType::CompressionException& e) {
-                    std::cerr << "[Security] Decompression error from " << remote_endpoint_ << ": "
-                              << e.what() << std::endl;
-                    if (running_) {
-                        start_receive();
-                    }
-                    return;
-                }
+    // Empty the socket buffer one batch per syscall; a short batch means it is drained.
+    const int fd = shard.socket->native_handle();
+    while (running_) {
+        for (auto& message : messages) {
+            message.msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+            message.msg_hdr.msg_flags = 0;
+        }
+
+        int received = ::recvmmsg(fd, messages.data(), static_cast<unsigned int>(RECV_BATCH),
+                                  MSG_DONTWAIT, nullptr);
+        if (received < 0) {
+            if (errno == EINTR) {
+                continue;
             }
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                std::cerr << "[Error] Receive error: " << std::strerror(errno) << std::endl;
+            }
+            break;
+        }
 
-            if (data.size() >= 2) {
-                uint16_t magic_number = static_cast<uint16_t>(
-                    static_cast<uint16_t>(data[0]) | (static_cast<uint16_t>(data[1]) << 8));
-                if (magic_number == 0xB542) {
-                    int client_id = register_client(remote_endpoint_);
-
-                    if (data.size() >= 3 && data[2] == 0x60) {
-                        if (data.size() >= 7) {
-                            uint32_t seq_id = static_cast<uint32_t>(data[3]) |
-                                              (static_cast<uint32_t>(data[4]) << 8) |
-                                              (static_cast<uint32_t>(data[5]) << 16) |
-                                              (static_cast<uint32_t>(data[6]) << 24);
-                            handle_ack(client_id, seq_id);
-                        }
-                    } else if (data.size() >= 7) {
-                        uint8_t opcode = data[2];
-                        bool is_reliable_opcode = (opcode == 0x02 ||
-                                                   opcode == 0x30 ||
-                                                   opcode == 0x50 ||
-                                                   opcode == 0x40 ||
-                                                   opcode == 0x37);
-
-                        if (is_reliable_opcode) {
-                            uint32_t seq_id = static_cast<uint32_t>(data[3]) |
-                                              (static_cast<uint32_t>(data[4]) << 8) |
-                                              (static_cast<uint32_t>(data[5]) << 16) |
-                                              (static_cast<uint32_t>(data[6]) << 24);
-
-                            std::vector<uint8_t> payload(data.begin() + 7, data.end());
-
-                            std::lock_guard<std::mutex> lock(reliability_mutex_);
-                            auto& state = client_reliability_[client_id];
-                            auto ready_packets = state.process_received_packet(seq_id, payload);
-
-                            send_ack(client_id, seq_id);
-
-                            for (auto& pkt : ready_packets) {
-                                std::vector<uint8_t> complete_packet;
-                                complete_packet.push_back(0x42);
-                                complete_packet.push_back(0xB5);
-                                complete_packet.push_back(opcode);
-                                complete_packet.insert(complete_packet.end(), pkt.begin(),
-                                                       pkt.end());
-
-                                NetworkPacket packet(std::move(complete_packet), remote_endpoint_);
-                                input_queue_.push(std::move(packet));
-                            }
-                        } else {
-                            NetworkPacket packet(std::move(data), remote_endpoint_);
-                            input_queue_.push(std::move(packet));
-                        }
-                    } else {
-                        NetworkPacket packet(std::move(data), remote_endpoint_);
-                        input_queue_.push(std::move(packet));
-                    }
-                } else {
-                    std::cerr << "[Security] Ignored packet with bad Magic Number from "
-                              << remote_endpoint_ << std::endl;
-                }
+        for (int i = 0; i < received; ++i) {
+            const auto& message = messages[static_cast<std::size_t>(i)];
+            if (message.msg_hdr.msg_flags & MSG_TRUNC) {
+                continue;
             }
+            asio::ip::udp::endpoint sender;
+            std::memcpy(sender.data(), &addresses[static_cast<std::size_t>(i)],
+                        message.msg_hdr.msg_namelen);
+            sender.resize(message.msg_hdr.msg_namelen);
+            dispatch_datagram(shard,
+                              std::span<const uint8_t>(slabs[static_cast<std::size_t>(i)].data(),
+                                                       message.msg_len),
+                              sender);
+        }
+
+        if (static_cast<std::size_t>(received) < RECV_BATCH) {
+            break;
         }
-    } else if (ec) {
+    }
+
+    for (auto slab : slabs) {
+        shard.recv_pool.release(slab);
+    }
+
+    // Acks queued while dispatching go out now, not at the next game tick.
+    send_queued(shard);
+
+    if (running_) {
+        start_receive(shard);
+    }
+}
+#else
+void UDPServer::start_receive(SocketShard& shard) {
+    if (shard.recv_slab.empty()) {
+        shard.recv_slab = shard.recv_pool.acquire();
+    }
+    shard.socket->async_receive_from(asio::buffer(shard.recv_slab.data(), shard.recv_slab.size()),
+                                     shard.remote_endpoint,
+                                     [this, &shard](std::error_code ec, std::size_t bytes_recvd) {
+                                         handle_receive(shard, ec, bytes_recvd);
+                                     });
+}
+#endif
+
+void UDPServer::handle_receive(SocketShard& shard, std::error_code ec,
+                               std::size_t bytes_received) {
+    if (!ec) {
+        dispatch_datagram(shard, std::span<const uint8_t>(shard.recv_slab.data(), bytes_received),
+                          shard.remote_endpoint);
+        send_queued(shard);
+    } else {
         std::cerr << "[Error] Receive error: " << ec.message() << std::endl;
     }
 
     if (running_) {
-        start_receive();
+        start_receive(shard);
     }
 }
 
+void UDPServer::dispatch_datagram(SocketShard& shard, std::span<const uint8_t> datagram,
+                                  const asio::ip::udp::endpoint& sender) {
+    if (datagram.size() < 2) {
+        return;
+    }
+
+    // Parsed in place; bytes are only copied into what outlives the receive slab.
+    std::span<const uint8_t> data = datagram;
+    if (data[0] == 0x00 || data[0] == 0x01) {
+        try {
+            data = RType::CompressionSerializer::decompress_view(datagram, shard.decompress_scratch);
+        } catch (const RType::CompressionException& e) {
+            std::cerr << "[Security] Decompression error from " << sender << ": " << e.what()
+                      << std::endl;
+            return;
+        }
+    }
+
+    if (data.size() < 2) {
+        return;
+    }
+
+    uint16_t magic_number = static_cast<uint16_t>(static_cast<uint16_t>(data[0]) |
+                                                  (static_cast<uint16_t>(data[1]) << 8));
+    if (magic_number != 0xB542) {
+        std::cerr << "[Security] Ignored packet with bad Magic Number from " << sender
+                  << std::endl;
+        return;
+    }
+
+    // One client table lookup per datagram. A client is pinned to the shard
+    // that first heard from it, and SO_REUSEPORT keeps its 4-tuple on that
+    // socket, so the owner is the receiving shard in practice.
+    const RegisteredClient client = register_client(sender, shard.index);
+    const int client_id = client.client_id;
+    SocketShard& owner = *shards_[client.shard];
+
+    if (data.size() >= 3 && data[2] == 0x60) {
+        if (data.size() >= 7) {
+            uint32_t seq_id = static_cast<uint32_t>(data[3]) |
+                              (static_cast<uint32_t>(data[4]) << 8) |
+                              (static_cast<uint32_t>(data[5]) << 16) |
+                              (static_cast<uint32_t>(data[6]) << 24);
+            handle_ack(owner, client_id, seq_id);
+        }
+        return;
+    }
+
+    if (data.size() >= 7) {
+        uint8_t opcode = data[2];
+        bool is_reliable_opcode = (opcode == 0x02 ||
+                                   opcode == 0x30 ||
+                                   opcode == 0x50 ||
+                                   opcode == 0x40 ||
+                                   opcode == 0x37);
+
+        if (is_reliable_opcode) {
+            // Not acked while the game thread is behind, so the client resends
+            // it instead of the packet being acked and then dropped.
+            if (shard.input_queue.size() >= shard.input_queue.capacity()) {
+                return;
+            }
+
+            uint32_t seq_id = static_cast<uint32_t>(data[3]) |
+                              (static_cast<uint32_t>(data[4]) << 8) |
+                              (static_cast<uint32_t>(data[5]) << 16) |
+                              (static_cast<uint32_t>(data[6]) << 24);
+
+            // Buffered as the packet minus its sequence id, so whatever the
+            // reorder buffer releases is ready to queue with its own opcode.
+            std::vector<uint8_t> packet;
+            packet.reserve(data.size() - 4);
+            packet.insert(packet.end(), data.begin(), data.begin() + 3);
+            packet.insert(packet.end(), data.begin() + 7, data.end());
+
+            std::lock_guard<std::mutex> lock(owner.reliability_mutex);
+            auto& state = owner.reliability[client_id];
+            auto ready_packets = state.process_received_packet(seq_id, std::move(packet));
+
+            queue_ack(shard, sender, seq_id);
+
+            for (auto& pkt : ready_packets) {
+                shard.input_queue.push(NetworkPacket(std::move(pkt), sender, client_id));
+            }
+            return;
+        }
+    }
+
+    shard.input_queue.push(
+        NetworkPacket(std::vector<uint8_t>(data.begin(), data.end()), sender, client_id));
+}
+
 void UDPServer::queue_output_packet(NetworkPacket packet) {
-    asio::post(io_context_, [this, packet = std::move(packet)]() {
-        socket_->async_send_to(
-            asio::buffer(packet.data), packet.sender, [](std::error_code ec, std::size_t) {
-                if (ec) {
-                    std::cerr << "[Error] Send failed: " << ec.message() << std::endl;
-                }
-            });
-    });
+    shards_.front()->output_queue.push(
+        std::make_shared<const std::vector<uint8_t>>(std::move(packet.data)), packet.sender);
+}
+
+void UDPServer::flush_output() {
+    for (auto& shard : shards_) {
+        if (shard->output_queue.empty() || shard->flush_posted.exchange(true)) {
+            continue;
+        }
+        asio::post(*shard->context, [this, target = shard.get()]() {
+            target->flush_posted = false;
+            send_queued(*target);
+        });
+    }
+}
+
+void UDPServer::send_queued(SocketShard& shard) {
+    // A send blocked on a full socket buffer resumes from its write wait.
+    if (shard.send_waiting) {
+        return;
+    }
+
+    while (true) {
+        if (shard.send_cursor == shard.send_batch.size()) {
+            shard.send_cursor = 0;
+            if (!shard.output_queue.take(shard.send_batch)) {
+                return;
+            }
+        }
+
+#ifdef __linux__
+        if (!send_batch(shard)) {
+            shard.send_waiting = true;
+            shard.socket->async_wait(asio::ip::udp::socket::wait_write,
+                                     [this, &shard](std::error_code ec) {
+                                         shard.send_waiting = false;
+                                         if (ec) {
+                                             std::cerr << "[Error] Send failed: " << ec.message()
+                                                       << std::endl;
+                                             return;
+                                         }
+                                         send_queued(shard);
+                                     });
+            return;
+        }
+#else
+        for (; shard.send_cursor < shard.send_batch.size(); ++shard.send_cursor) {
+            auto& datagram = shard.send_batch[shard.send_cursor];
+            shard.socket->async_send_to(asio::buffer(*datagram.payload), datagram.endpoint,
+                                   [payload = datagram.payload](std::error_code ec, std::size_t) {
+                                       if (ec) {
+                                           std::cerr << "[Error] Send failed: " << ec.message()
+                                                     << std::endl;
+                                       }
+                                   });
+        }
+#endif
+    }
+}
+
+#ifdef __linux__
+// False when the socket buffer filled up before the batch was sent.
+bool UDPServer::send_batch(SocketShard& shard) {
+    std::array<iovec, SEND_BATCH> iovecs{};
+    std::array<mmsghdr, SEND_BATCH> messages{};
+    const int fd = shard.socket->native_handle();
+
+    while (shard.send_cursor < shard.send_batch.size()) {
+        std::size_t count = std::min(SEND_BATCH, shard.send_batch.size() - shard.send_cursor);
+        for (std::size_t i = 0; i < count; ++i) {
+            auto& datagram = shard.send_batch[shard.send_cursor + i];
+            iovecs[i].iov_base = const_cast<uint8_t*>(datagram.payload->data());
+            iovecs[i].iov_len = datagram.payload->size();
+            messages[i].msg_hdr = msghdr{};
+            messages[i].msg_hdr.msg_iov = &iovecs[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+            messages[i].msg_hdr.msg_name = datagram.endpoint.data();
+            messages[i].msg_hdr.msg_namelen = static_cast<socklen_t>(datagram.endpoint.size());
+        }
+
+        int sent = ::sendmmsg(fd, messages.data(), static_cast<unsigned int>(count), MSG_DONTWAIT);
+        if (sent < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                return false;
+            }
+            // Only the first datagram of the call failed; drop it and go on.
+            std::cerr << "[Error] Send failed: " << std::strerror(errno) << std::endl;
+            ++shard.send_cursor;
+            continue;
+        }
+        shard.send_cursor += static_cast<std::size_t>(sent);
+    }
+
+    // Let go of the payloads now rather than at the next take().
+    shard.send_batch.clear();
+    shard.send_cursor = 0;
+    return true;
 }
+#endif
 
 void UDPServer::send_to_all(const std::vector<uint8_t>& data) {
+    auto payload = std::make_shared<const std::vector<uint8_t>>(data);
     std::lock_guard<std::mutex> lock(clients_mutex_);
-    for (const auto& [id, client] : clients_) {
-        NetworkPacket packet(data, client.endpoint);
-        queue_output_packet(packet);
+    for (const auto& client : clients_) {
+        shards_[client.shard]->output_queue.push(payload, client.endpoint);
     }
 }
 
 void UDPServer::send_to_clients(const std::vector<int>& client_ids,
                                 const std::vector<uint8_t>& data) {
+    send_to_clients(client_ids, std::make_shared<const std::vector<uint8_t>>(data));
+}
+
+void UDPServer::send_to_clients(const std::vector<int>& client_ids, SharedPayload payload) {
     std::lock_guard<std::mutex> lock(clients_mutex_);
     for (int client_id : client_ids) {
-        auto it = clients_.find(client_id);
-        if (it != clients_.end()) {
-            NetworkPacket packet(data, it->second.endpoint);
-            queue_output_packet(packet);
+        if (const ClientEndpoint* client = clients_.find(client_id)) {
+            shards_[client->shard]->output_queue.push(payload, client->endpoint);
         }
     }
 }
 
 void UDPServer::send_to_client(int client_id, const std::vector<uint8_t>& data) {
     std::lock_guard<std::mutex> lock(clients_mutex_);
-    auto it = clients_.find(client_id);
-    if (it != clients_.end()) {
-        NetworkPacket packet(data, it->second.endpoint);
-        queue_output_packet(packet);
+    if (const ClientEndpoint* client = clients_.find(client_id)) {
+        shards_[client->shard]->output_queue.push(std::make_shared<const std::vector<uint8_t>>(data),
+                                                  client->endpoint);
     }
 }
 
 void UDPServer::send_to_endpoint(const asio::ip::udp::endpoint& endpoint,
                                  const std::vector<uint8_t>& data) {
-    NetworkPacket packet(data, endpoint);
-    queue_output_packet(packet);
+    shards_.front()->output_queue.push(std::make_shared<const std::vector<uint8_t>>(data),
+                                       endpoint);
 }
 
-int UDPServer::register_client(const asio::ip::udp::endpoint& endpoint) {
+UDPServer::RegisteredClient UDPServer::register_client(const asio::ip::udp::endpoint& endpoint,
+                                                       std::size_t shard) {
     std::lock_guard<std::mutex> lock(clients_mutex_);
 
-    for (auto& [id, client] : clients_) {
-        if (client.endpoint == endpoint) {
-            client.last_seen = std::chrono::steady_clock::now();
-            return id;
-        }
+    if (ClientEndpoint* client = clients_.find(endpoint)) {
+        client->last_seen = std::chrono::steady_clock::now();
+        return {client->client_id, client->shard};
     }
 
     int client_id = next_client_id_++;
-    clients_[client_id] = ClientEndpoint(endpoint, client_id);
+    ClientEndpoint& client = clients_.add(endpoint, client_id);
+    client.shard = shard < shards_.size() ? shard : 0;
     std::cout << "[Network] New client registered: ID=" << client_id << " ("
               << endpoint.address().to_string() << ")" << std::endl;
-    return client_id;
+    return {client_id, client.shard};
 }
 
 std::vector<int> UDPServer::remove_inactive_clients(std::chrono::seconds timeout) {
@@ -247,21 +494,37 @@ std::vector<int> UDPServer::remove_inactive_clients(std::chrono::seconds timeout
     std::vector<int> removed_ids;
     auto now = std::chrono::steady_clock::now();
 
-    for (auto it = clients_.begin(); it != clients_.end();) {
-        auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - it->second.last_seen);
+    for (const auto& client : clients_) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - client.last_seen);
         if (elapsed > timeout) {
-            std::cout << "[Network] Client timed out: ID=" << it->first << std::endl;
-            removed_ids.push_back(it->first);
-            it = clients_.erase(it);
-        } else {
-            ++it;
+            std::cout << "[Network] Client timed out: ID=" << client.client_id << std::endl;
+            removed_ids.push_back(client.client_id);
         }
     }
+    for (int client_id : removed_ids) {
+        clients_.erase(client_id);
+    }
     return removed_ids;
 }
 
 bool UDPServer::get_input_packet(NetworkPacket& packet) {
-    return input_queue_.try_pop(packet);
+    for (std::size_t tried = 0; tried < shards_.size(); ++tried) {
+        SocketShard& shard = *shards_[next_input_shard_];
+        next_input_shard_ = (next_input_shard_ + 1) % shards_.size();
+        if (shard.input_queue.try_pop(packet)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::size_t UDPServer::get_input_packets(std::vector<NetworkPacket>& packets) {
+    packets.clear();
+    // A client always lands on the same shard, so its packets stay in order.
+    for (auto& shard : shards_) {
+        shard->input_queue.pop_n(packets, shard->input_queue.capacity());
+    }
+    return packets.size();
 }
 
 size_t UDPServer::get_client_count() {
@@ -270,55 +533,77 @@ size_t UDPServer::get_client_count() {
 }
 
 size_t UDPServer::get_input_queue_size() const {
-    return input_queue_.size();
+    size_t total = 0;
+    for (const auto& shard : shards_) {
+        total += shard->input_queue.size();
+    }
+    return total;
+}
+
+uint64_t UDPServer::get_input_dropped_count() const {
+    uint64_t total = 0;
+    for (const auto& shard : shards_) {
+        total += shard->input_queue.dropped();
+    }
+    return total;
 }
 
 std::map<int, ClientEndpoint> UDPServer::get_clients() {
     std::lock_guard<std::mutex> lock(clients_mutex_);
-    return clients_;
+    std::map<int, ClientEndpoint> result;
+    for (const auto& client : clients_) {
+        result[client.client_id] = client;
+    }
+    return result;
 }
 
 std::map<int, asio::ip::udp::endpoint> UDPServer::get_all_clients() {
     std::lock_guard<std::mutex> lock(clients_mutex_);
     std::map<int, asio::ip::udp::endpoint> result;
-    for (const auto& [id, client] : clients_) {
-        result[id] = client.endpoint;
+    for (const auto& client : clients_) {
+        result[client.client_id] = client.endpoint;
     }
     return result;
 }
 
 void UDPServer::disconnect_client(int client_id) {
-    std::lock_guard<std::mutex> lock(clients_mutex_);
-    auto it = clients_.find(client_id);
-    if (it != clients_.end()) {
-        std::cout << "[Network] Disconnecting client: ID=" << client_id << " ("
-                  << it->second.endpoint.address().to_string() << ":" << it->second.endpoint.port()
-                  << ")" << std::endl;
-
-        try {
-            std::vector<uint8_t> disconnect_packet = {0x42, 0xB5, 0x40};
-            if (socket_) {
-                socket_->send_to(asio::buffer(disconnect_packet), it->second.endpoint);
-                std::cout << "[Network] Disconnect notification sent to client " << client_id
-                          << std::endl;
-            } else {
-                std::cerr
-                    << "[Network] Socket is null, cannot send disconnect notification for client "
-                    << client_id << std::endl;
-            }
-        } catch (const std::exception& e) {
-            std::cerr << "[Network] Failed to send disconnect notification: " << e.what()
-                      << std::endl;
+    std::optional<ClientEndpoint> removed;
+    {
+        std::lock_guard<std::mutex> lock(clients_mutex_);
+        if (const ClientEndpoint* client = clients_.find(client_id)) {
+            removed = *client;
+            clients_.erase(client_id);
         }
+    }
 
-        clients_.erase(it);
-        std::cout << "[Network] Client " << client_id << " removed from server" << std::endl;
-
-        cleanup_client_reliability(client_id);
-    } else {
+    if (!removed) {
         std::cout << "[Network] Client " << client_id << " not found (already disconnected?)"
                   << std::endl;
+        return;
     }
+
+    std::cout << "[Network] Disconnecting client: ID=" << client_id << " ("
+              << removed->endpoint.address().to_string() << ":" << removed->endpoint.port() << ")"
+              << std::endl;
+
+    try {
+        std::vector<uint8_t> disconnect_packet = {0x42, 0xB5, 0x40};
+        auto& socket = shards_[removed->shard]->socket;
+        if (socket) {
+            socket->send_to(asio::buffer(disconnect_packet), removed->endpoint);
+            std::cout << "[Network] Disconnect notification sent to client " << client_id
+                      << std::endl;
+        } else {
+            std::cerr << "[Network] Socket is null, cannot send disconnect notification for client "
+                      << client_id << std::endl;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "[Network] Failed to send disconnect notification: " << e.what() << std::endl;
+    }
+
+    std::cout << "[Network] Client " << client_id << " removed from server" << std::endl;
+
+    cleanup_client_reliability(client_id);
 }
 
 void UDPServer::run_network_loop() {
@@ -331,19 +616,41 @@ void UDPServer::run_network_loop() {
     std::cout << "[System] Network thread stopped." << std::endl;
 }
 
+void UDPServer::run_shard(SocketShard& shard) {
+    try {
+        shard.context->run();
+    } catch (const std::exception& e) {
+        std::cerr << "[Fatal] Network shard " << shard.index << " crashed: " << e.what()
+                  << std::endl;
+    }
+}
+
 void UDPServer::stop() {
     running_ = false;
     work_guard_.reset();
     io_context_.stop();
-    if (socket_) {
-        socket_->close();
+    for (auto& shard : shards_) {
+        if (shard->owned_context) {
+            shard->owned_context->stop();
+        }
+        if (shard->socket) {
+            boost::system::error_code ignored;
+            shard->socket->close(ignored);
+        }
     }
 }
 
+UDPServer::SocketShard& UDPServer::shard_of(int client_id) {
+    std::lock_guard<std::mutex> lock(clients_mutex_);
+    const ClientEndpoint* client = clients_.find(client_id);
+    return *shards_[client ? client->shard : 0];
+}
+
 void UDPServer::send_reliable(int client_id, uint8_t opcode, const std::vector<uint8_t>& payload) {
-    std::lock_guard<std::mutex> lock(reliability_mutex_);
+    SocketShard& shard = shard_of(client_id);
+    std::lock_guard<std::mutex> lock(shard.reliability_mutex);
 
-    auto& state = client_reliability_[client_id];
+    auto& state = shard.reliability[client_id];
     uint32_t seq_id = state.get_next_send_sequence();
 
     std::vector<uint8_t> packet;
@@ -372,7 +679,9 @@ void UDPServer::send_reliable(int client_id, uint8_t opcode, const std::vector<u
               << static_cast<int>(opcode) << std::dec << " to client " << client_id << std::endl;
 }
 
-void UDPServer::send_ack(int client_id, uint32_t sequence_id) {
+namespace {
+
+std::vector<uint8_t> make_ack_packet(uint32_t sequence_id) {
     std::vector<uint8_t> ack_packet;
     ack_packet.reserve(7);
 
@@ -385,15 +694,31 @@ void UDPServer::send_ack(int client_id, uint32_t sequence_id) {
     ack_packet.push_back(static_cast<uint8_t>((sequence_id >> 8) & 0xFF));
     ack_packet.push_back(static_cast<uint8_t>((sequence_id >> 16) & 0xFF));
     ack_packet.push_back(static_cast<uint8_t>((sequence_id >> 24) & 0xFF));
+    return ack_packet;
+}
+
+}  // namespace
 
-    send_to_client(client_id, ack_packet);
+void UDPServer::send_ack(int client_id, uint32_t sequence_id) {
+    send_to_client(client_id, make_ack_packet(sequence_id));
+}
+
+// Receive path: the sender is already known, so skip the client table.
+void UDPServer::queue_ack(SocketShard& shard, const asio::ip::udp::endpoint& sender,
+                          uint32_t sequence_id) {
+    shard.output_queue.push(
+        std::make_shared<const std::vector<uint8_t>>(make_ack_packet(sequence_id)), sender);
 }
 
 void UDPServer::handle_ack(int client_id, uint32_t sequence_id) {
-    std::lock_guard<std::mutex> lock(reliability_mutex_);
+    handle_ack(shard_of(client_id), client_id, sequence_id);
+}
+
+void UDPServer::handle_ack(SocketShard& shard, int client_id, uint32_t sequence_id) {
+    std::lock_guard<std::mutex> lock(shard.reliability_mutex);
 
-    auto it = client_reliability_.find(client_id);
-    if (it == client_reliability_.end()) {
+    auto it = shard.reliability.find(client_id);
+    if (it == shard.reliability.end()) {
         return;
     }
 
@@ -410,10 +735,17 @@ void UDPServer::handle_ack(int client_id, uint32_t sequence_id) {
 }
 
 void UDPServer::retry_unacked_packets() {
-    std::lock_guard<std::mutex> lock(reliability_mutex_);
     auto now = std::chrono::steady_clock::now();
 
-    for (auto& [client_id, state] : client_reliability_) {
+    for (auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard->reliability_mutex);
+        retry_unacked_packets(shard->reliability, now);
+    }
+}
+
+void UDPServer::retry_unacked_packets(std::map<int, RType::ClientReliabilityState>& states,
+                                      std::chrono::steady_clock::time_point now) {
+    for (auto& [client_id, state] : states) {
         for (auto it = state.pending_acks.begin(); it != state.pending_acks.end();) {
             if (it->should_retry(now)) {
                 if (it->max_retries_reached()) {
@@ -441,20 +773,24 @@ void UDPServer::retry_thread_loop() {
     while (running_) {
         std::this_thread::sleep_for(std::chrono::milliseconds(50));
         retry_unacked_packets();
+        flush_output();
     }
 
     std::cout << "[Reliable] Retry thread stopped" << std::endl;
 }
 
 void UDPServer::cleanup_client_reliability(int client_id) {
-    std::lock_guard<std::mutex> lock(reliability_mutex_);
+    // The client record may already be gone, so check every shard.
+    for (auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard->reliability_mutex);
 
-    auto it = client_reliability_.find(client_id);
-    if (it != client_reliability_.end()) {
-        std::cout << "[Reliable] Cleaning up reliability state for client " << client_id
-                  << std::endl;
-        it->second.reset();
-        client_reliability_.erase(it);
+        auto it = shard->reliability.find(client_id);
+        if (it != shard->reliability.end()) {
+            std::cout << "[Reliable] Cleaning up reliability state for client " << client_id
+                      << std::endl;
+            it->second.reset();
+            shard->reliability.erase(it);
+        }
     }
 }
 
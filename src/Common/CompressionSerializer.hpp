@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 #include <vector>
 #include <stdexcept>
 #include <lz4.h>
@@ -119,40 +120,58 @@ public:
     bool decompress() {
         std::vector<uint8_t>& buffer = data();
 
-        if (buffer.empty()) {
+        if (!buffer.empty() && buffer[0] == UNCOMPRESSED_FLAG) {
+            buffer.erase(buffer.begin());
+            return false;
+        }
+
+        std::vector<uint8_t> decompressed;
+        decompress_view(buffer, decompressed);
+        buffer = std::move(decompressed);
+
+        return true;
+    }
+
+    /**
+     * Body of a framed buffer without copying the frame: a view past the flag
+     * byte when stored uncompressed, otherwise @p scratch holding the
+     * decompressed bytes (its capacity is reused across calls).
+     */
+    static std::span<const uint8_t> decompress_view(std::span<const uint8_t> framed,
+                                                    std::vector<uint8_t>& scratch) {
+        if (framed.empty()) {
             throw CompressionException("Cannot decompress empty buffer");
         }
 
-        uint8_t flag = buffer[0];
+        uint8_t flag = framed[0];
 
         if (flag == UNCOMPRESSED_FLAG) {
-            buffer.erase(buffer.begin());
-            return false;
+            return framed.subspan(1);
         }
 
         if (flag != COMPRESSED_FLAG) {
             throw CompressionException("Invalid compression flag: " + std::to_string(flag));
         }
 
-        if (buffer.size() < 6) {
+        if (framed.size() < 6) {
             throw CompressionException("Compressed buffer too small");
         }
 
         uint32_t original_size =
-            static_cast<uint32_t>(buffer[1]) |
-            (static_cast<uint32_t>(buffer[2]) << 8) |
-            (static_cast<uint32_t>(buffer[3]) << 16) |
-            (static_cast<uint32_t>(buffer[4]) << 24);
+            static_cast<uint32_t>(framed[1]) |
+            (static_cast<uint32_t>(framed[2]) << 8) |
+            (static_cast<uint32_t>(framed[3]) << 16) |
+            (static_cast<uint32_t>(framed[4]) << 24);
 
         if (original_size == 0 || original_size > 1024 * 1024) {
             throw CompressionException("Invalid original size: " + std::to_string(original_size));
         }
 
-        std::vector<uint8_t> decompressed(original_size);
+        scratch.resize(original_size);
         int decompressed_size = LZ4_decompress_safe(
-            reinterpret_cast<const char*>(buffer.data() + 5),
-            reinterpret_cast<char*>(decompressed.data()),
-            static_cast<int>(buffer.size() - 5),
+            reinterpret_cast<const char*>(framed.data() + 5),
+            reinterpret_cast<char*>(scratch.data()),
+            static_cast<int>(framed.size() - 5),
             static_cast<int>(original_size)
         );
 
@@ -167,9 +186,7 @@ public:
             );
         }
 
-        buffer = std::move(decompressed);
-
-        return true;
+        return scratch;
     }
 
 
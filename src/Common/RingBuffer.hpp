@@ -0,0 +1,253 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace RType {
+
+namespace ring_detail {
+
+inline constexpr std::size_t cache_line = 64;
+
+inline std::size_t round_up_pow2(std::size_t n) {
+    std::size_t capacity = 2;
+    while (capacity < n) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+}  // namespace ring_detail
+
+/**
+ * Bounded lock-free queue for exactly one producer thread and one consumer thread.
+ *
+ * Capacity is rounded up to a power of two. A push onto a full ring fails and
+ * is counted in dropped(), so the producer never waits on the consumer.
+ */
+template <typename T>
+class SpscRing {
+public:
+    explicit SpscRing(std::size_t capacity = 1024)
+        : mask_(ring_detail::round_up_pow2(capacity) - 1),
+          slots_(std::make_unique<Slot[]>(mask_ + 1)) {}
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    ~SpscRing() {
+        const std::size_t tail = tail_.load(std::memory_order_acquire);
+        for (std::size_t pos = head_.load(std::memory_order_relaxed); pos != tail; ++pos) {
+            slots_[pos & mask_].get()->~T();
+        }
+    }
+
+    bool push(const T& value) { return emplace(value); }
+    bool push(T&& value) { return emplace(std::move(value)); }
+
+    template <typename... Args>
+    bool emplace(Args&&... args) {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - cached_head_ > mask_) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (tail - cached_head_ > mask_) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        }
+        new (slots_[tail & mask_].bytes) T(std::forward<Args>(args)...);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_pop(T& out) {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == cached_tail_) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head == cached_tail_) {
+                return false;
+            }
+        }
+        T* value = slots_[head & mask_].get();
+        out = std::move(*value);
+        value->~T();
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Appends up to @p max queued values to @p out; returns how many.
+    std::size_t pop_n(std::vector<T>& out, std::size_t max) {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        cached_tail_ = tail_.load(std::memory_order_acquire);
+        std::size_t count = std::min(cached_tail_ - head, max);
+        for (std::size_t i = 0; i < count; ++i) {
+            T* value = slots_[(head + i) & mask_].get();
+            out.push_back(std::move(*value));
+            value->~T();
+        }
+        head_.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    std::size_t size() const {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+    bool empty() const { return size() == 0; }
+    std::size_t capacity() const { return mask_ + 1; }
+    std::uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    struct Slot {
+        alignas(T) unsigned char bytes[sizeof(T)];
+        T* get() { return std::launder(reinterpret_cast<T*>(bytes)); }
+    };
+
+    const std::size_t mask_;
+    std::unique_ptr<Slot[]> slots_;
+
+    // Each side keeps its index and its stale copy of the other side's on its
+    // own cache line, so the threads only share a line when the copy runs out.
+    alignas(ring_detail::cache_line) std::atomic<std::size_t> head_{0};
+    std::size_t cached_tail_ = 0;
+    alignas(ring_detail::cache_line) std::atomic<std::size_t> tail_{0};
+    std::size_t cached_head_ = 0;
+    alignas(ring_detail::cache_line) std::atomic<std::uint64_t> dropped_{0};
+};
+
+/**
+ * Bounded lock-free queue for any number of producer threads and one consumer.
+ *
+ * Producers claim a cell with a compare-and-swap on the tail and publish it
+ * through the cell's sequence number; the consumer never takes a lock. As
+ * with SpscRing, pushing onto a full ring fails and counts a drop.
+ * wait_and_pop() sleeps on an atomic counter, so an idle consumer costs
+ * nothing and producers only pay for a wake-up when someone is waiting.
+ */
+template <typename T>
+class MpscRing {
+public:
+    explicit MpscRing(std::size_t capacity = 1024)
+        : mask_(ring_detail::round_up_pow2(capacity) - 1),
+          cells_(std::make_unique<Cell[]>(mask_ + 1)) {
+        for (std::size_t i = 0; i <= mask_; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscRing(const MpscRing&) = delete;
+    MpscRing& operator=(const MpscRing&) = delete;
+
+    ~MpscRing() {
+        for (std::size_t pos = head_.load(std::memory_order_relaxed);; ++pos) {
+            Cell& cell = cells_[pos & mask_];
+            if (cell.sequence.load(std::memory_order_acquire) != pos + 1) {
+                break;
+            }
+            cell.get()->~T();
+        }
+    }
+
+    bool push(const T& value) { return emplace(value); }
+    bool push(T&& value) { return emplace(std::move(value)); }
+
+    template <typename... Args>
+    bool emplace(Args&&... args) {
+        std::size_t pos = tail_.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells_[pos & mask_];
+            const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto diff =
+                static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+        new (cell->bytes) T(std::forward<Args>(args)...);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+
+        published_.fetch_add(1, std::memory_order_release);
+        published_.notify_one();
+        return true;
+    }
+
+    bool try_pop(T& out) {
+        const std::size_t pos = head_.load(std::memory_order_relaxed);
+        Cell& cell = cells_[pos & mask_];
+        if (cell.sequence.load(std::memory_order_acquire) != pos + 1) {
+            return false;
+        }
+        T* value = cell.get();
+        out = std::move(*value);
+        value->~T();
+        cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+        head_.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Appends up to @p max published values to @p out; returns how many.
+    std::size_t pop_n(std::vector<T>& out, std::size_t max) {
+        std::size_t pos = head_.load(std::memory_order_relaxed);
+        std::size_t count = 0;
+        for (; count < max; ++count, ++pos) {
+            Cell& cell = cells_[pos & mask_];
+            if (cell.sequence.load(std::memory_order_acquire) != pos + 1) {
+                break;
+            }
+            T* value = cell.get();
+            out.push_back(std::move(*value));
+            value->~T();
+            cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+        }
+        head_.store(pos, std::memory_order_release);
+        return count;
+    }
+
+    void wait_and_pop(T& out) {
+        while (!try_pop(out)) {
+            const std::uint32_t seen = published_.load(std::memory_order_acquire);
+            if (try_pop(out)) {
+                return;
+            }
+            published_.wait(seen, std::memory_order_acquire);
+        }
+    }
+
+    // Approximate while producers are mid-push.
+    std::size_t size() const {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+    bool empty() const { return size() == 0; }
+    std::size_t capacity() const { return mask_ + 1; }
+    std::uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        alignas(T) unsigned char bytes[sizeof(T)];
+        T* get() { return std::launder(reinterpret_cast<T*>(bytes)); }
+    };
+
+    const std::size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+
+    alignas(ring_detail::cache_line) std::atomic<std::size_t> head_{0};
+    alignas(ring_detail::cache_line) std::atomic<std::size_t> tail_{0};
+    alignas(ring_detail::cache_line) std::atomic<std::uint32_t> published_{0};
+    std::atomic<std::uint64_t> dropped_{0};
+};
+
+}  // namespace RType
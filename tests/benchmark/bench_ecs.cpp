@@ -0,0 +1,275 @@
+/**
+ * @file bench_ecs.cpp
+ * @brief Google Benchmark suite for the ECS containers and queries.
+ *
+ * Entity counts are 1k/10k/100k; iteration benchmarks also take the share
+ * (in percent) of entities owning the second component, to expose how each
+ * query copes with sparse pools. Run `cmake --build . --target bench_ecs_json`
+ * to write bench_ecs.json, then compare two runs with Google Benchmark's
+ * tools/compare.py.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "ecs/indexed_zipper.hpp"
+#include "ecs/registry.hpp"
+#include "ecs/zipper.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace {
+
+struct Position {
+    float x, y;
+};
+
+struct Velocity {
+    float vx, vy;
+};
+
+struct Health {
+    int hp;
+};
+
+constexpr std::uint32_t seed = 0x5eed;
+
+// Entity i owns Velocity when it falls in the first density% of every hundred.
+bool owns_second(std::size_t i, std::int64_t density) {
+    return static_cast<std::int64_t>(i % 100) < density;
+}
+
+void populate(registry& reg, std::size_t count, std::int64_t density) {
+    for (std::size_t i = 0; i < count; ++i) {
+        auto e = reg.spawn_entity();
+        reg.emplace_component<Position>(e, static_cast<float>(i), 0.0f);
+        if (owns_second(i, density)) {
+            reg.emplace_component<Velocity>(e, 1.0f, 0.5f);
+        }
+    }
+}
+
+std::vector<std::size_t> shuffled_indices(std::size_t count) {
+    std::vector<std::size_t> indices(count);
+    std::iota(indices.begin(), indices.end(), 0);
+    std::shuffle(indices.begin(), indices.end(), std::mt19937(seed));
+    return indices;
+}
+
+void entity_counts(benchmark::internal::Benchmark* bench) {
+    for (std::int64_t count : {1000, 10000, 100000}) {
+        bench->Arg(count);
+    }
+}
+
+void entity_counts_and_density(benchmark::internal::Benchmark* bench) {
+    for (std::int64_t count : {1000, 10000, 100000}) {
+        for (std::int64_t density : {100, 50, 10}) {
+            bench->Args({count, density});
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// registry: entity lifecycle
+// ---------------------------------------------------------------------------
+
+void BM_RegistrySpawn(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        registry reg;
+        for (std::size_t i = 0; i < count; ++i) {
+            auto e = reg.spawn_entity();
+            reg.emplace_component<Position>(e, 0.0f, 0.0f);
+            reg.emplace_component<Health>(e, 100);
+        }
+        benchmark::DoNotOptimize(reg.alive_count());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RegistrySpawn)->Apply(entity_counts);
+
+// Kill and respawn a tenth of a live population per iteration, like a wave of
+// projectiles expiring while new ones are fired.
+void BM_RegistryChurn(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    registry reg;
+    std::vector<entity> live;
+    live.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        auto e = reg.spawn_entity();
+        reg.emplace_component<Position>(e, 0.0f, 0.0f);
+        reg.emplace_component<Velocity>(e, 1.0f, 0.0f);
+        live.push_back(e);
+    }
+
+    const std::size_t batch = std::max<std::size_t>(1, count / 10);
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<std::size_t> pick(0, count - 1);
+    for (auto _ : state) {
+        for (std::size_t n = 0; n < batch; ++n) {
+            auto& slot = live[pick(rng)];
+            reg.kill_entity(slot);
+            slot = reg.spawn_entity();
+            reg.emplace_component<Position>(slot, 0.0f, 0.0f);
+            reg.emplace_component<Velocity>(slot, 1.0f, 0.0f);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(batch));
+}
+BENCHMARK(BM_RegistryChurn)->Apply(entity_counts);
+
+// ---------------------------------------------------------------------------
+// sparse_array: insert / erase patterns
+// ---------------------------------------------------------------------------
+
+void BM_SparseArrayInsertSequential(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        sparse_array<Position> positions;
+        for (std::size_t i = 0; i < count; ++i) {
+            positions.insert_at(i, Position{0.0f, 0.0f});
+        }
+        benchmark::DoNotOptimize(positions.dense_size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SparseArrayInsertSequential)->Apply(entity_counts);
+
+void BM_SparseArrayInsertRandom(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto order = shuffled_indices(count);
+    for (auto _ : state) {
+        sparse_array<Position> positions;
+        for (std::size_t i : order) {
+            positions.insert_at(i, Position{0.0f, 0.0f});
+        }
+        benchmark::DoNotOptimize(positions.dense_size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SparseArrayInsertRandom)->Apply(entity_counts);
+
+void BM_SparseArrayEraseRandom(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto order = shuffled_indices(count);
+    for (auto _ : state) {
+        state.PauseTiming();
+        sparse_array<Position> positions;
+        for (std::size_t i = 0; i < count; ++i) {
+            positions.insert_at(i, Position{0.0f, 0.0f});
+        }
+        state.ResumeTiming();
+        for (std::size_t i : order) {
+            positions.erase(i);
+        }
+        benchmark::DoNotOptimize(positions.dense_size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SparseArrayEraseRandom)->Apply(entity_counts);
+
+// ---------------------------------------------------------------------------
+// Iteration over Position + Velocity at varying Velocity density
+// ---------------------------------------------------------------------------
+
+void BM_ZipperIterate(benchmark::State& state) {
+    registry reg;
+    populate(reg, static_cast<std::size_t>(state.range(0)), state.range(1));
+    auto& positions = reg.get_components<Position>();
+    auto& velocities = reg.get_components<Velocity>();
+    for (auto _ : state) {
+        for (auto&& [pos, vel] : containers::zipper(positions, velocities)) {
+            pos.x += vel.vx;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ZipperIterate)->Apply(entity_counts_and_density);
+
+void BM_IndexedZipperIterate(benchmark::State& state) {
+    registry reg;
+    populate(reg, static_cast<std::size_t>(state.range(0)), state.range(1));
+    auto& positions = reg.get_components<Position>();
+    auto& velocities = reg.get_components<Velocity>();
+    for (auto _ : state) {
+        for (auto&& [idx, pos, vel] : containers::indexed_zipper(positions, velocities)) {
+            pos.x += vel.vx;
+            benchmark::DoNotOptimize(idx);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_IndexedZipperIterate)->Apply(entity_counts_and_density);
+
+void BM_ViewIterate(benchmark::State& state) {
+    registry reg;
+    populate(reg, static_cast<std::size_t>(state.range(0)), state.range(1));
+    for (auto _ : state) {
+        reg.view<Position, Velocity>().each(
+            [](std::size_t, Position& pos, Velocity& vel) { pos.x += vel.vx; });
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ViewIterate)->Apply(entity_counts_and_density);
+
+void BM_GroupIterate(benchmark::State& state) {
+    registry reg;
+    populate(reg, static_cast<std::size_t>(state.range(0)), state.range(1));
+    auto group = reg.group<Position, Velocity>();
+    for (auto _ : state) {
+        group.each([](std::size_t, Position& pos, Velocity& vel) { pos.x += vel.vx; });
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GroupIterate)->Apply(entity_counts_and_density);
+
+// ---------------------------------------------------------------------------
+// Random component lookup
+// ---------------------------------------------------------------------------
+
+void BM_ComponentLookup(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    registry reg;
+    populate(reg, count, 50);
+    const auto order = shuffled_indices(count);
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (std::size_t i : order) {
+            auto vel = reg.get_component<Velocity>(reg.entity_from_index(i));
+            if (vel) {
+                sum += vel->vx;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ComponentLookup)->Apply(entity_counts);
+
+void BM_HasComponent(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    registry reg;
+    populate(reg, count, 50);
+    const auto order = shuffled_indices(count);
+    for (auto _ : state) {
+        std::size_t owners = 0;
+        for (std::size_t i : order) {
+            owners += reg.has_component<Velocity>(reg.entity_from_index(i)) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(owners);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HasComponent)->Apply(entity_counts);
+
+}  // namespace
+
+BENCHMARK_MAIN();
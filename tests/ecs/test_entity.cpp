@@ -10,6 +10,9 @@
  */
 
 #include <gtest/gtest.h>
+#include "ecs/registry.hpp"
+
+#include <utility>
 
 class DISABLED_EntityTest : public ::testing::Test {
 protected:
@@ -41,3 +44,85 @@ TEST_F(DISABLED_EntityTest, ReuseDestroyedEntity) {
     // TODO: Test entity ID reuse after destruction
     GTEST_SKIP() << "Not implemented yet";
 }
+
+TEST(EntityHandleTest, SpawnedEntitiesAreAlive) {
+    registry reg;
+    auto a = reg.spawn_entity();
+    auto b = reg.spawn_entity();
+
+    EXPECT_NE(a, b);
+    EXPECT_TRUE(reg.is_alive(a));
+    EXPECT_TRUE(reg.is_alive(b));
+    EXPECT_EQ(reg.entity_from_index(a.id()), a);
+}
+
+TEST(EntityHandleTest, StaleHandleDoesNotAliasReusedSlot) {
+    registry reg;
+    auto old_entity = reg.spawn_entity();
+    reg.add_component(old_entity, 42);
+    reg.kill_entity(old_entity);
+
+    auto new_entity = reg.spawn_entity();
+    reg.add_component(new_entity, 7);
+
+    EXPECT_EQ(new_entity.id(), old_entity.id());
+    EXPECT_NE(new_entity, old_entity);
+    EXPECT_FALSE(reg.is_alive(old_entity));
+    EXPECT_TRUE(reg.is_alive(new_entity));
+
+    reg.remove_component<int>(old_entity);
+    reg.kill_entity(old_entity);
+    EXPECT_TRUE(reg.is_alive(new_entity));
+    ASSERT_TRUE(reg.get_component<int>(new_entity).has_value());
+    EXPECT_EQ(reg.get_component<int>(new_entity).value(), 7);
+}
+
+TEST(EntityHandleTest, StaleHandleCannotAddComponents) {
+    registry reg;
+    auto old_entity = reg.spawn_entity();
+    reg.kill_entity(old_entity);
+
+    EXPECT_FALSE(reg.add_component(old_entity, 42).has_value());
+    EXPECT_FALSE(reg.get_components<int>().contains(old_entity.id()));
+
+    auto new_entity = reg.spawn_entity();
+    ASSERT_EQ(new_entity.id(), old_entity.id());
+
+    EXPECT_FALSE(reg.add_component(old_entity, 42).has_value());
+    EXPECT_FALSE(reg.emplace_component<double>(old_entity, 1.5).has_value());
+    EXPECT_FALSE(reg.has_component<int>(new_entity));
+    EXPECT_FALSE(reg.has_component<double>(new_entity));
+    EXPECT_FALSE(reg.get_component<int>(new_entity).has_value());
+    EXPECT_EQ(reg.get_components<int>().dense_size(), 0u);
+}
+
+TEST(EntityHandleTest, StaleHandleCannotReadRecycledSlot) {
+    registry reg;
+    auto old_entity = reg.spawn_entity();
+    reg.add_component(old_entity, 1);
+    reg.kill_entity(old_entity);
+
+    auto new_entity = reg.spawn_entity();
+    ASSERT_EQ(new_entity.id(), old_entity.id());
+    reg.add_component(new_entity, 2);
+
+    EXPECT_FALSE(reg.get_component<int>(old_entity).has_value());
+    EXPECT_FALSE(std::as_const(reg).get_component<int>(old_entity).has_value());
+    ASSERT_TRUE(reg.get_component<int>(new_entity).has_value());
+    EXPECT_EQ(*reg.get_component<int>(new_entity), 2);
+}
+
+TEST(EntityHandleTest, FreedSlotsAreReusedInKillOrder) {
+    registry reg;
+    auto a = reg.spawn_entity();
+    auto b = reg.spawn_entity();
+    auto c = reg.spawn_entity();
+
+    reg.kill_entity(b);
+    reg.kill_entity(a);
+    reg.kill_entity(a);
+
+    EXPECT_EQ(reg.spawn_entity().id(), b.id());
+    EXPECT_EQ(reg.spawn_entity().id(), a.id());
+    EXPECT_EQ(reg.spawn_entity().id(), c.id() + 1);
+}
@@ -10,6 +10,10 @@
  */
 
 #include <gtest/gtest.h>
+#include "ecs/prefab.hpp"
+#include "ecs/registry.hpp"
+
+#include <memory>
 
 class DISABLED_RegistryTest : public ::testing::Test {
 protected:
@@ -46,3 +50,97 @@ TEST_F(DISABLED_RegistryTest, RunSystems) {
     // TODO: Test running all registered systems
     GTEST_SKIP() << "Not implemented yet";
 }
+
+namespace {
+
+struct Health {
+    int hp;
+};
+
+struct Tag {};
+
+struct Frames {
+    std::shared_ptr<const int> table;
+};
+
+}  // namespace
+
+TEST(RegistrySignatureTest, HasComponentTracksAddAndRemove) {
+    registry reg;
+    auto e = reg.spawn_entity();
+
+    EXPECT_FALSE(reg.has_component<Health>(e));
+    reg.add_component(e, Health{3});
+    reg.emplace_component<Tag>(e);
+    EXPECT_TRUE(reg.has_component<Health>(e));
+    EXPECT_TRUE(reg.has_component<Tag>(e));
+
+    reg.remove_component<Health>(e);
+    EXPECT_FALSE(reg.has_component<Health>(e));
+    EXPECT_TRUE(reg.has_component<Tag>(e));
+}
+
+TEST(RegistrySignatureTest, KillErasesOnlyOwnedComponents) {
+    registry reg;
+    auto a = reg.spawn_entity();
+    auto b = reg.spawn_entity();
+    reg.add_component(a, Health{1});
+    reg.emplace_component<Tag>(a);
+    reg.add_component(b, Health{2});
+
+    reg.kill_entity(a);
+
+    auto& healths = reg.get_components<Health>();
+    EXPECT_FALSE(healths[a.id()].has_value());
+    EXPECT_FALSE(reg.get_components<Tag>()[a.id()].has_value());
+    ASSERT_TRUE(healths[b.id()].has_value());
+    EXPECT_EQ(healths[b.id()]->hp, 2);
+
+    auto reused = reg.spawn_entity();
+    EXPECT_EQ(reused.id(), a.id());
+    EXPECT_FALSE(reg.has_component<Health>(reused));
+}
+
+TEST(RegistrySignatureTest, ComponentTypeIdsAreStableAndShared) {
+    EXPECT_EQ(component_type_id<Health>(), component_type_id<Health>());
+    EXPECT_NE(component_type_id<Health>(), component_type_id<Tag>());
+
+    registry first;
+    registry second;
+    auto e = second.spawn_entity();
+    second.add_component(e, Health{5});
+    EXPECT_THROW(static_cast<registry const&>(first).get_components<Health>(), std::runtime_error);
+    EXPECT_EQ(static_cast<registry const&>(second).get_components<Health>()[e.id()]->hp, 5);
+}
+
+TEST(PrefabTest, InstantiateCopiesDefaultsAndAppliesOverrides) {
+    registry reg;
+    const prefab<Health, Tag, Frames> tmpl{Health{10}, Tag{}, Frames{std::make_shared<const int>(7)}};
+
+    auto plain = tmpl.instantiate(reg);
+    auto hurt = tmpl.instantiate(reg, Health{3});
+
+    EXPECT_TRUE(reg.has_component<Tag>(plain));
+    EXPECT_EQ(reg.get_components<Health>().find(plain.id())->hp, 10);
+    EXPECT_EQ(reg.get_components<Health>().find(hurt.id())->hp, 3);
+    EXPECT_EQ(tmpl.get<Health>().hp, 10);
+
+    // Shared tables are referenced, not copied.
+    auto const* frames = reg.get_components<Frames>().find(hurt.id());
+    EXPECT_EQ(frames->table.get(), tmpl.get<Frames>().table.get());
+    EXPECT_EQ(tmpl.get<Frames>().table.use_count(), 3);
+}
+
+TEST(PrefabTest, ReservedInstancesDoNotMoveEarlierComponents) {
+    registry reg;
+    const prefab<Health> tmpl{Health{1}};
+    auto first = tmpl.instantiate(reg);
+    tmpl.reserve(reg, 64);
+
+    Health const* before = reg.get_components<Health>().find(first.id());
+    for (int i = 0; i < 64; ++i) {
+        tmpl.instantiate(reg, Health{i});
+    }
+    EXPECT_EQ(reg.get_components<Health>().find(first.id()), before);
+    EXPECT_EQ(reg.alive_count(), 65u);
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include "ecs/sparse_array.hpp"
+#include "ecs/zipper.hpp"
+
+#include <set>
+
+namespace {
+
+struct Position {
+    float x, y;
+    Position(float px = 0.0f, float py = 0.0f) : x(px), y(py) {}
+};
+
+}  // namespace
+
+TEST(SparseArrayTest, InsertAndAccess) {
+    sparse_array<Position> positions;
+    auto& ref = positions.insert_at(3, Position(1.0f, 2.0f));
+
+    EXPECT_EQ(positions[3].get(), &ref);
+    EXPECT_FLOAT_EQ(positions[3]->x, 1.0f);
+    EXPECT_FALSE(positions[0].has_value());
+    EXPECT_FALSE(positions[100].has_value());
+    EXPECT_EQ(positions.size(), 4u);
+    EXPECT_EQ(positions.dense_size(), 1u);
+}
+
+TEST(SparseArrayTest, InsertOverwritesExistingSlot) {
+    sparse_array<Position> positions;
+    positions.insert_at(2, Position(1.0f, 1.0f));
+    positions.emplace_at(2, 5.0f, 6.0f);
+
+    EXPECT_EQ(positions.dense_size(), 1u);
+    EXPECT_FLOAT_EQ(positions[2]->x, 5.0f);
+    EXPECT_FLOAT_EQ(positions[2]->y, 6.0f);
+}
+
+TEST(SparseArrayTest, EraseKeepsOtherComponentsReachable) {
+    sparse_array<Position> positions;
+    for (std::size_t i = 0; i < 5; ++i) {
+        positions.insert_at(i, Position(static_cast<float>(i), 0.0f));
+    }
+
+    positions.erase(1);
+    positions.erase(1);
+    positions.erase(42);
+
+    EXPECT_EQ(positions.dense_size(), 4u);
+    EXPECT_FALSE(positions[1].has_value());
+    for (std::size_t i : {0u, 2u, 3u, 4u}) {
+        ASSERT_TRUE(positions[i].has_value());
+        EXPECT_FLOAT_EQ(positions[i]->x, static_cast<float>(i));
+    }
+}
+
+TEST(SparseArrayTest, DenseIterationVisitsOnlyLiveComponents) {
+    sparse_array<Position> positions;
+    positions.insert_at(10, Position(10.0f, 0.0f));
+    positions.insert_at(5000, Position(5000.0f, 0.0f));
+    positions.insert_at(20, Position(20.0f, 0.0f));
+    positions.erase(10);
+
+    std::set<std::size_t> visited;
+    positions.for_each([&](std::size_t idx, Position& pos) {
+        EXPECT_FLOAT_EQ(pos.x, static_cast<float>(idx));
+        visited.insert(idx);
+    });
+
+    EXPECT_EQ(visited, (std::set<std::size_t>{20, 5000}));
+    EXPECT_EQ(positions.size(), 5001u);
+}
+
+TEST(SparseArrayTest, GetIndexFromReference) {
+    sparse_array<Position> positions;
+    positions.insert_at(7, Position());
+    positions.insert_at(3, Position());
+
+    Position outside;
+
+    EXPECT_EQ(positions.get_index(*positions[7]), 7u);
+    EXPECT_EQ(positions.get_index(*positions[3]), 3u);
+    EXPECT_EQ(positions.get_index(outside), sparse_array<Position>::npos);
+}
+
+TEST(SparseArrayTest, ZipperStaysIndexAligned) {
+    sparse_array<Position> positions;
+    sparse_array<int> ids;
+    positions.insert_at(0, Position(0.0f, 0.0f));
+    positions.insert_at(2, Position(2.0f, 0.0f));
+    ids.insert_at(2, 2);
+    ids.insert_at(1, 1);
+
+    int matches = 0;
+    for (auto&& [pos, id] : containers::zipper(positions, ids)) {
+        EXPECT_FLOAT_EQ(pos.x, static_cast<float>(id));
+        ++matches;
+    }
+    EXPECT_EQ(matches, 1);
+}
+
+TEST(SparseArrayTest, LookupOfMissingIndexIsEmptyAndCreatesNothing) {
+    sparse_array<Position> positions;
+    positions.insert_at(1, Position(1.0f, 0.0f));
+
+    auto missing = positions[7];
+    EXPECT_FALSE(missing.has_value());
+    EXPECT_FALSE(static_cast<bool>(missing));
+    EXPECT_THROW(missing.value(), std::bad_optional_access);
+    EXPECT_FALSE(positions.contains(7));
+    EXPECT_EQ(positions.dense_size(), 1u);
+    EXPECT_EQ(positions.size(), 2u);
+}
+
+TEST(SparseArrayTest, RangeForWalksOnlyLiveComponents) {
+    sparse_array<Position> positions;
+    positions.insert_at(3, Position(3.0f, 0.0f));
+    positions.insert_at(9000, Position(9000.0f, 0.0f));
+
+    std::size_t visited = 0;
+    for (Position& pos : positions) {
+        EXPECT_EQ(positions.get_index(pos), static_cast<std::size_t>(pos.x));
+        ++visited;
+    }
+    EXPECT_EQ(visited, 2u);
+}
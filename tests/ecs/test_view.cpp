@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include "ecs/registry.hpp"
+
+#include <set>
+
+namespace {
+
+struct Position {
+    float x, y;
+};
+
+struct Velocity {
+    float vx, vy;
+};
+
+struct Frozen {};
+
+}  // namespace
+
+TEST(ViewTest, VisitsOnlyEntitiesWithAllComponents) {
+    registry reg;
+    auto moving = reg.spawn_entity();
+    auto still = reg.spawn_entity();
+    auto ghost = reg.spawn_entity();
+    reg.add_component(moving, Position{0.0f, 0.0f});
+    reg.add_component(moving, Velocity{1.0f, 2.0f});
+    reg.add_component(still, Position{5.0f, 5.0f});
+    reg.add_component(ghost, Velocity{3.0f, 3.0f});
+
+    std::set<std::size_t> visited;
+    reg.view<Position, Velocity>().each([&](std::size_t idx, Position& pos, Velocity& vel) {
+        pos.x += vel.vx;
+        visited.insert(idx);
+    });
+
+    EXPECT_EQ(visited, (std::set<std::size_t>{moving.id()}));
+    EXPECT_FLOAT_EQ(reg.get_components<Position>()[moving.id()]->x, 1.0f);
+}
+
+TEST(ViewTest, RangeForYieldsIndexAndComponents) {
+    registry reg;
+    for (int i = 0; i < 4; ++i) {
+        auto e = reg.spawn_entity();
+        reg.add_component(e, Position{static_cast<float>(i), 0.0f});
+        if (i % 2 == 0)
+            reg.add_component(e, Velocity{0.0f, 0.0f});
+    }
+
+    int count = 0;
+    for (auto&& [idx, pos, vel] : reg.view<Position, Velocity>()) {
+        EXPECT_FLOAT_EQ(pos.x, static_cast<float>(idx));
+        (void)vel;
+        ++count;
+    }
+    EXPECT_EQ(count, 2);
+}
+
+TEST(ViewTest, KillingCurrentEntityWhileIteratingIsSafe) {
+    registry reg;
+    for (int i = 0; i < 8; ++i) {
+        auto e = reg.spawn_entity();
+        reg.add_component(e, Position{static_cast<float>(i), 0.0f});
+    }
+
+    int visited = 0;
+    reg.view<Position>().each([&](std::size_t idx, Position&) {
+        reg.kill_entity(reg.entity_from_index(idx));
+        ++visited;
+    });
+
+    EXPECT_EQ(visited, 8);
+    EXPECT_EQ(reg.get_components<Position>().dense_size(), 0u);
+}
+
+TEST(GroupTest, MembershipFollowsAddRemoveAndKill) {
+    registry reg;
+    auto a = reg.spawn_entity();
+    auto b = reg.spawn_entity();
+    reg.add_component(a, Position{});
+    reg.add_component(a, Velocity{});
+    reg.add_component(b, Position{});
+
+    auto group = reg.group<Position, Velocity>();
+    EXPECT_EQ(group.size_hint(), 1u);
+
+    reg.add_component(b, Velocity{});
+    EXPECT_EQ(group.size_hint(), 2u);
+
+    reg.remove_component<Velocity>(a);
+    EXPECT_EQ(group.size_hint(), 1u);
+
+    reg.add_component(b, Frozen{});
+    reg.kill_entity(b);
+    EXPECT_EQ(group.size_hint(), 0u);
+
+    auto c = reg.spawn_entity();
+    reg.emplace_component<Velocity>(c, 1.0f, 1.0f);
+    reg.emplace_component<Position>(c, 2.0f, 2.0f);
+
+    std::set<std::size_t> visited;
+    for (auto&& [idx, pos, vel] : reg.group<Position, Velocity>()) {
+        EXPECT_FLOAT_EQ(pos.x, 2.0f);
+        EXPECT_FLOAT_EQ(vel.vx, 1.0f);
+        visited.insert(idx);
+    }
+    EXPECT_EQ(visited, (std::set<std::size_t>{c.id()}));
+}
+
+TEST(ParallelEachTest, ChunksCoverEveryMatchingEntityOnce) {
+    registry reg;
+    for (int i = 0; i < 5000; ++i) {
+        auto e = reg.spawn_entity();
+        reg.add_component(e, Position{0.0f, 0.0f});
+        if (i % 3 != 0)
+            reg.add_component(e, Velocity{1.0f, 0.0f});
+    }
+
+    std::size_t chunk_calls = 0;
+    reg.set_parallel_executor([&](std::size_t count, std::function<void(std::size_t)> const& fn) {
+        chunk_calls = count;
+        for (std::size_t c = count; c-- > 0;)
+            fn(c);
+    });
+
+    reg.parallel_each<Position, Velocity>(
+        [](std::size_t, Position& pos, Velocity& vel) { pos.x += vel.vx; });
+
+    EXPECT_GT(chunk_calls, 1u);
+    reg.get_components<Position>().for_each([](std::size_t idx, Position& pos) {
+        EXPECT_FLOAT_EQ(pos.x, idx % 3 != 0 ? 1.0f : 0.0f);
+    });
+}
+
+TEST(ParallelEachTest, SmallPoolsStaySerial) {
+    registry reg;
+    auto e = reg.spawn_entity();
+    reg.add_component(e, Position{0.0f, 0.0f});
+
+    bool executor_used = false;
+    reg.set_parallel_executor([&](std::size_t, std::function<void(std::size_t)> const&) {
+        executor_used = true;
+    });
+    reg.parallel_each<Position>([](std::size_t, Position& pos) { pos.y = 3.0f; });
+
+    EXPECT_FALSE(executor_used);
+    EXPECT_FLOAT_EQ(reg.get_components<Position>()[e.id()]->y, 3.0f);
+}
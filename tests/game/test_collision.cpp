@@ -10,6 +10,14 @@
  */
 
 #include <gtest/gtest.h>
+#include "systems/collision_grid.hpp"
+#include "systems/collision_layer_resolver.hpp"
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <set>
+#include <vector>
 
 class DISABLED_CollisionTest : public ::testing::Test {
 protected:
@@ -41,3 +49,221 @@ TEST_F(DISABLED_CollisionTest, CollisionResponse) {
     // TODO: Test collision callbacks are triggered
     GTEST_SKIP() << "Not implemented yet";
 }
+
+TEST(AabbTest, OverlapExcludesTouchingEdges) {
+    aabb a = aabb::from(position{0.0f, 0.0f}, collision_box(10.0f, 10.0f));
+    EXPECT_TRUE(a.overlaps(aabb{5.0f, 5.0f, 15.0f, 15.0f}));
+    EXPECT_FALSE(a.overlaps(aabb{10.0f, 0.0f, 20.0f, 10.0f}));
+    EXPECT_FALSE(a.overlaps(aabb{0.0f, 11.0f, 10.0f, 20.0f}));
+}
+
+TEST(AabbTest, MultiHitboxBoundsCoverEveryPart) {
+    multi_hitbox hitbox;
+    hitbox.parts.emplace_back(20.0f, 10.0f, -10.0f, 0.0f);
+    hitbox.parts.emplace_back(5.0f, 40.0f, 30.0f, -20.0f);
+    aabb bounds = aabb::bounds(position{100.0f, 100.0f}, hitbox);
+    EXPECT_FLOAT_EQ(bounds.left, 90.0f);
+    EXPECT_FLOAT_EQ(bounds.top, 80.0f);
+    EXPECT_FLOAT_EQ(bounds.right, 135.0f);
+    EXPECT_FLOAT_EQ(bounds.bottom, 120.0f);
+}
+
+TEST(AabbBatchTest, EveryKernelMatchesScalarOverlap) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> coord(-50.0f, 250.0f);
+    std::uniform_real_distribution<float> extent(0.0f, 60.0f);
+
+    aabb_soa boxes;
+    boxes.resize(203);  // Not a multiple of 4 or 8, so the tails run too
+    for (std::size_t i = 0; i < boxes.size(); ++i) {
+        float x = coord(rng);
+        float y = coord(rng);
+        boxes.set(i, aabb{x, y, x + extent(rng), y + extent(rng)});
+    }
+    boxes.set(17, aabb{std::nanf(""), 0.0f, 10.0f, 10.0f});
+
+    const auto supported = aabb_batch::detect();
+    std::vector<aabb_batch::isa> sets{aabb_batch::isa::scalar};
+    if (supported >= aabb_batch::isa::sse) sets.push_back(aabb_batch::isa::sse);
+    if (supported >= aabb_batch::isa::avx2) sets.push_back(aabb_batch::isa::avx2);
+
+    std::vector<std::uint32_t> out(boxes.size());
+    for (int probe_count = 0; probe_count < 50; ++probe_count) {
+        float x = coord(rng);
+        float y = coord(rng);
+        aabb probe{x, y, x + extent(rng), y + extent(rng)};
+        for (std::uint32_t begin : {0u, 3u, 9u}) {
+            std::vector<std::uint32_t> expected;
+            for (std::uint32_t i = begin; i < boxes.size(); ++i) {
+                aabb box{boxes.left[i], boxes.top[i], boxes.right[i], boxes.bottom[i]};
+                if (box.overlaps(probe)) expected.push_back(i);
+            }
+            for (auto set : sets) {
+                auto count = aabb_batch::select(set)(boxes, begin, static_cast<std::uint32_t>(boxes.size()),
+                                                     probe, out.data());
+                std::vector<std::uint32_t> got(out.begin(), out.begin() + count);
+                EXPECT_EQ(got, expected) << "isa " << static_cast<int>(set);
+            }
+        }
+    }
+}
+
+TEST(AabbSweepTest, FastShotDoesNotTunnelThroughThinTarget) {
+    aabb wall{100.0f, 0.0f, 104.0f, 50.0f};
+    // Moved 200 to the right this tick: started left of the wall, ended right of it.
+    aabb shot{220.0f, 20.0f, 230.0f, 25.0f};
+    ASSERT_FALSE(shot.overlaps(wall));
+
+    EXPECT_TRUE(shot.swept(200.0f, 0.0f).overlaps(wall));
+    float t = shot.sweep_time(200.0f, 0.0f, wall);
+    EXPECT_NEAR(t, 0.35f, 1e-5f);  // Right edge 30 -> 230 reaches x = 100 at 70 / 200
+
+    aabb rising{220.0f, 80.0f, 230.0f, 85.0f};
+    EXPECT_TRUE(rising.swept(200.0f, 40.0f).overlaps(wall));
+    EXPECT_LT(rising.sweep_time(200.0f, 40.0f, wall), 0.0f);  // Already below the wall when crossing it
+    EXPECT_LT(shot.sweep_time(-200.0f, 0.0f, wall), 0.0f);  // Came from the right
+}
+
+TEST(AabbSweepTest, WithoutMotionMatchesOverlap) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> coord(0.0f, 100.0f);
+    std::uniform_real_distribution<float> extent(0.0f, 30.0f);
+    for (int i = 0; i < 500; ++i) {
+        float ax = coord(rng);
+        float ay = coord(rng);
+        float bx = coord(rng);
+        float by = coord(rng);
+        aabb a{ax, ay, ax + extent(rng), ay + extent(rng)};
+        aabb b{bx, by, bx + extent(rng), by + extent(rng)};
+        float t = a.sweep_time(0.0f, 0.0f, b);
+        EXPECT_EQ(t == 0.0f, a.overlaps(b));
+        EXPECT_TRUE(t == 0.0f || t < 0.0f);
+    }
+}
+
+TEST(CollisionGridTest, QueryReturnsOverlappingEntitiesOnce) {
+    collision_grid grid(64.0f);
+    grid.insert(1, aabb{10.0f, 10.0f, 20.0f, 20.0f});
+    grid.insert(2, aabb{100.0f, 10.0f, 300.0f, 200.0f});  // spans several cells
+    grid.insert(3, aabb{1000.0f, 500.0f, 1010.0f, 510.0f});
+    grid.build();
+
+    std::multiset<std::size_t> hits;
+    grid.query(aabb{0.0f, 0.0f, 250.0f, 150.0f}, [&](std::size_t idx) { hits.insert(idx); });
+    EXPECT_EQ(hits, (std::multiset<std::size_t>{1, 2}));
+}
+
+TEST(CollisionGridTest, OffscreenBoxesAreClampedIntoBorderCells) {
+    collision_grid grid;
+    grid.insert(7, aabb{-300.0f, -50.0f, -250.0f, -10.0f});
+    grid.insert(8, aabb{2500.0f, 2000.0f, 2600.0f, 2100.0f});
+    grid.build();
+
+    std::set<std::size_t> hits;
+    grid.query(aabb{-280.0f, -40.0f, -260.0f, -20.0f}, [&](std::size_t idx) { hits.insert(idx); });
+    grid.query(aabb{2550.0f, 2050.0f, 2560.0f, 2060.0f}, [&](std::size_t idx) { hits.insert(idx); });
+    EXPECT_EQ(hits, (std::set<std::size_t>{7, 8}));
+}
+
+TEST(CollisionGridTest, FirstHitPicksLowestAcceptedIndex) {
+    collision_grid grid;
+    grid.insert(9, aabb{0.0f, 0.0f, 50.0f, 50.0f});
+    grid.insert(4, aabb{10.0f, 10.0f, 60.0f, 60.0f});
+    grid.insert(2, aabb{20.0f, 20.0f, 70.0f, 70.0f});
+    grid.build();
+
+    aabb probe{25.0f, 25.0f, 30.0f, 30.0f};
+    EXPECT_EQ(grid.first_hit(probe, [](std::size_t) { return true; }), 2u);
+    EXPECT_EQ(grid.first_hit(probe, [](std::size_t idx) { return idx != 2; }), 4u);
+    EXPECT_EQ(grid.first_hit(aabb{500.0f, 500.0f, 510.0f, 510.0f}, [](std::size_t) { return true; }),
+              collision_grid::npos);
+}
+
+TEST(CollisionGridTest, EarliestHitPrefersFirstContactThenLowestIndex) {
+    collision_grid grid;
+    grid.insert(3, aabb{100.0f, 0.0f, 110.0f, 10.0f});
+    grid.insert(8, aabb{40.0f, 0.0f, 50.0f, 10.0f});
+    grid.insert(5, aabb{40.0f, 0.0f, 50.0f, 10.0f});
+    grid.build();
+
+    // A shot that moved 150 to the right this tick, ending past every target.
+    aabb shot{160.0f, 2.0f, 165.0f, 6.0f};
+    auto impact = [&](std::size_t idx) {
+        aabb const target = idx == 3 ? aabb{100.0f, 0.0f, 110.0f, 10.0f} : aabb{40.0f, 0.0f, 50.0f, 10.0f};
+        return shot.sweep_time(150.0f, 0.0f, target);
+    };
+    EXPECT_EQ(grid.earliest_hit(shot.swept(150.0f, 0.0f), impact), 5u);
+    EXPECT_EQ(grid.earliest_hit(shot.swept(150.0f, 0.0f), [&](std::size_t idx) {
+        return idx == 3 ? impact(idx) : -1.0f;
+    }), 3u);
+    EXPECT_EQ(grid.earliest_hit(shot, impact), collision_grid::npos);
+}
+
+TEST(CollisionGridTest, ClearDropsPreviousTick) {
+    collision_grid grid;
+    grid.insert(1, aabb{0.0f, 0.0f, 10.0f, 10.0f});
+    grid.build();
+    grid.clear();
+    grid.insert(2, aabb{0.0f, 0.0f, 10.0f, 10.0f});
+    grid.build();
+
+    std::set<std::size_t> hits;
+    grid.query(aabb{0.0f, 0.0f, 5.0f, 5.0f}, [&](std::size_t idx) { hits.insert(idx); });
+    EXPECT_EQ(hits, (std::set<std::size_t>{2}));
+}
+
+TEST(CollisionLayerTest, PresetMasksPickTheirTargets) {
+    auto shot = collision_layer::player_projectile();
+    EXPECT_TRUE(shot.tests(collision_layer::Enemy));
+    EXPECT_TRUE(shot.tests(collision_layer::EnemyProjectile));
+    EXPECT_FALSE(shot.tests(collision_layer::PlayerProjectile));
+    EXPECT_FALSE(shot.tests(collision_layer::BossProjectile));
+    EXPECT_FALSE(shot.tests(collision_layer::Player));
+
+    auto enemy_shot = collision_layer::enemy_projectile();
+    EXPECT_TRUE(enemy_shot.tests(collision_layer::Player));
+    EXPECT_TRUE(enemy_shot.tests(collision_layer::AllyProjectile));
+    EXPECT_FALSE(collision_layer::boss_projectile().tests(collision_layer::player_shots));
+    EXPECT_EQ(collision_layer::enemy().mask, 0);
+}
+
+TEST(CollisionLayerTest, ResolverPrefersAttachedLayer) {
+    registry reg;
+    auto e = reg.spawn_entity();
+    reg.add_component(e, projectile_tag{});
+    reg.add_component(e, collision_layer::boss_projectile());
+
+    collision_layer_resolver resolve(reg);
+    EXPECT_EQ(resolve(e.id()).category, collision_layer::BossProjectile);
+}
+
+TEST(CollisionLayerTest, ResolverInfersLayerFromTags) {
+    registry reg;
+    auto drone_shot = reg.spawn_entity();
+    reg.add_component(drone_shot, projectile_tag{});
+    reg.add_component(drone_shot, ally_projectile_tag{});
+
+    auto boss_shot = reg.spawn_entity();
+    reg.add_component(boss_shot, projectile_tag{});
+    reg.add_component(boss_shot, enemy_tag{});
+    reg.add_component(boss_shot, entity_tag{RType::EntityType::Enemy3});
+
+    auto part = reg.spawn_entity();
+    reg.add_component(part, serpent_part{});
+    reg.add_component(part, enemy_tag{});
+
+    auto boss = reg.spawn_entity();
+    reg.add_component(boss, boss_tag{});
+    reg.add_component(boss, enemy_tag{});
+
+    auto explosion = reg.spawn_entity();
+    reg.add_component(explosion, explosion_tag{});
+
+    collision_layer_resolver resolve(reg);
+    EXPECT_EQ(resolve(drone_shot.id()).category, collision_layer::AllyProjectile);
+    EXPECT_EQ(resolve(boss_shot.id()).category, collision_layer::BossProjectile);
+    EXPECT_EQ(resolve(part.id()).category, collision_layer::SerpentPart);
+    EXPECT_TRUE(resolve(part.id()).tests(collision_layer::Player));
+    EXPECT_EQ(resolve(boss.id()).category, collision_layer::Enemy | collision_layer::Boss);
+    EXPECT_EQ(resolve(explosion.id()).category, 0);
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "components/logic_components.hpp"
+#include "systems/transform_hierarchy.hpp"
 
 TEST(Controllable, DefaultSpeed) {
     controllable ctrl;
@@ -51,6 +52,24 @@ TEST(BoundedMovement, ClampPosition) {
     EXPECT_FLOAT_EQ(y, 600.0f);
 }
 
+TEST(MovementPattern, SinePreset) {
+    auto pattern = movement_pattern::sine(100.0f, 3.0f, 0.5f, 0.01f);
+    EXPECT_EQ(pattern.type, movement_pattern::kind::sine);
+    EXPECT_FLOAT_EQ(pattern.amplitude, 100.0f);
+    EXPECT_FLOAT_EQ(pattern.frequency, 3.0f);
+    EXPECT_FLOAT_EQ(pattern.phase, 0.5f);
+    EXPECT_FLOAT_EQ(pattern.phase_per_x, 0.01f);
+}
+
+TEST(MovementPattern, ZigzagPresetIgnoresX) {
+    auto pattern = movement_pattern::zigzag(150.0f, 1.0f, 2.5f);
+    EXPECT_EQ(pattern.type, movement_pattern::kind::zigzag);
+    EXPECT_FLOAT_EQ(pattern.amplitude, 150.0f);
+    EXPECT_FLOAT_EQ(pattern.phase, 2.5f);
+    EXPECT_FLOAT_EQ(pattern.phase_per_x, 0.0f);
+    EXPECT_LT(static_cast<std::size_t>(pattern.type), movement_pattern::kind_count);
+}
+
 TEST(WaveManager, DefaultValues) {
     wave_manager wm;
     EXPECT_FLOAT_EQ(wm.timer, 0.0f);
@@ -77,3 +96,68 @@ TEST(WaveManager, TimerUpdate) {
     wm.timer = 0.0f;
     EXPECT_FLOAT_EQ(wm.timer, 0.0f);
 }
+
+TEST(TransformHierarchy, ResolvesChainsParentsFirstInOneUpdate) {
+    registry reg;
+    // Spawned leaf first so dense order is the reverse of the hierarchy.
+    auto leaf = reg.spawn_entity();
+    auto mid = reg.spawn_entity();
+    auto root = reg.spawn_entity();
+    reg.add_component(leaf, position{});
+    reg.add_component(mid, position{});
+    reg.add_component(root, position{100.0f, 50.0f});
+    reg.add_component(leaf, transform_link{mid, 1.0f, 2.0f});
+    reg.add_component(mid, transform_link{root, 10.0f, -5.0f});
+
+    transform_hierarchy transforms;
+    transforms.update(reg);
+    EXPECT_FLOAT_EQ(reg.get_components<position>().find(mid.id())->x, 110.0f);
+    EXPECT_FLOAT_EQ(reg.get_components<position>().find(leaf.id())->x, 111.0f);
+    EXPECT_FLOAT_EQ(reg.get_components<position>().find(leaf.id())->y, 47.0f);
+
+    reg.get_components<position>().find(root.id())->x = 0.0f;
+    transforms.update(reg);
+    EXPECT_FLOAT_EQ(reg.get_components<position>().find(leaf.id())->x, 11.0f);
+}
+
+TEST(TransformHierarchy, ReparentingInPlaceReordersTheSweep) {
+    registry reg;
+    auto child = reg.spawn_entity();
+    auto mid = reg.spawn_entity();
+    auto root = reg.spawn_entity();
+    reg.add_component(child, position{});
+    reg.add_component(mid, position{});
+    reg.add_component(root, position{100.0f, 0.0f});
+    reg.add_component(child, transform_link{root, 1.0f});
+    reg.add_component(mid, transform_link{root, 10.0f});
+
+    transform_hierarchy transforms;
+    transforms.update(reg);
+    EXPECT_FLOAT_EQ(reg.get_components<position>().find(child.id())->x, 101.0f);
+
+    // Now one level deeper than before, behind mid in the sweep.
+    reg.get_components<transform_link>().find(child.id())->parent = mid;
+    reg.get_components<position>().find(root.id())->x = 0.0f;
+    transforms.update(reg);
+    EXPECT_FLOAT_EQ(reg.get_components<position>().find(mid.id())->x, 10.0f);
+    EXPECT_FLOAT_EQ(reg.get_components<position>().find(child.id())->x, 11.0f);
+}
+
+TEST(TransformHierarchy, ChildOfDeadParentStaysPut) {
+    registry reg;
+    auto body = reg.spawn_entity();
+    auto scale = reg.spawn_entity();
+    reg.add_component(body, position{30.0f, 40.0f});
+    reg.add_component(scale, position{});
+    reg.add_component(scale, transform_link{body});
+
+    transform_hierarchy transforms;
+    transforms.update(reg);
+    reg.kill_entity(body);
+    auto recycled = reg.spawn_entity();
+    reg.add_component(recycled, position{500.0f, 500.0f});
+    transforms.update(reg);
+
+    EXPECT_FLOAT_EQ(reg.get_components<position>().find(scale.id())->x, 30.0f);
+    EXPECT_FLOAT_EQ(reg.get_components<position>().find(scale.id())->y, 40.0f);
+}
@@ -10,6 +10,8 @@
  */
 
 #include <gtest/gtest.h>
+#include "components/game_components.hpp"
+#include "entities/projectile_factory.hpp"
 
 class DISABLED_SpawningTest : public ::testing::Test {
 protected:
@@ -46,3 +48,39 @@ TEST_F(DISABLED_SpawningTest, MaxEntitiesLimit) {
     // TODO: Test entity count limits are respected
     GTEST_SKIP() << "Not implemented yet";
 }
+
+TEST(CustomProjectile, ShotsOfOneConfigShareTheirTemplateData) {
+    registry reg;
+    custom_attack_config config;
+    config.projectile_texture = "assets/custom/long-projectile-name.png";
+    config.projectile_frame_width = 20;
+    config.projectile_frame_height = 10;
+    config.projectile_frame_count = 3;
+    config.projectile_scale = 2.0f;
+    config.projectile_mirror_x = true;
+
+    entity first = createCustomProjectile(reg, 10.0f, 20.0f, -100.0f, 0.0f, 7, config);
+    entity second = createCustomProjectile(reg, 30.0f, 40.0f, -100.0f, 0.0f, 9, config);
+
+    auto first_sprite = reg.get_component<sprite_component>(first);
+    auto second_sprite = reg.get_component<sprite_component>(second);
+    ASSERT_TRUE(first_sprite.has_value() && second_sprite.has_value());
+    EXPECT_EQ(first_sprite->texture(), config.projectile_texture);
+    EXPECT_EQ(first_sprite->texture_path, second_sprite->texture_path);
+    EXPECT_TRUE(first_sprite->mirror_x);
+
+    auto first_anim = reg.get_component<animation_component>(first);
+    auto second_anim = reg.get_component<animation_component>(second);
+    ASSERT_EQ(first_anim->frame_list().size(), 3u);
+    EXPECT_EQ(first_anim->shared_frames, second_anim->shared_frames);
+    EXPECT_EQ(first_anim->frame_list()[2].left, 40);
+
+    EXPECT_EQ(reg.get_component<custom_entity_id>(second)->id(), config.projectile_texture);
+    EXPECT_EQ(reg.get_component<damage_on_contact>(second)->damage_amount, 9);
+    EXPECT_FLOAT_EQ(reg.get_component<position>(second)->x, 30.0f);
+    EXPECT_FLOAT_EQ(reg.get_component<collision_box>(second)->width, 32.0f);
+
+    config.projectile_frame_count = 1;
+    entity other = createCustomProjectile(reg, 0.0f, 0.0f, 0.0f, 0.0f, 1, config);
+    EXPECT_EQ(reg.get_component<animation_component>(other)->frame_list().size(), 1u);
+}
@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+#include "core/SystemManager.hpp"
+#include "systems/system_wrappers.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+// Registration order of GameSession.
+enum game_system : size_t { Shooting, Wave, Movement, EnemyShooting, Explosive, Collision, Cleanup };
+
+size_t stage_of(std::vector<std::vector<size_t>> const& stages, size_t system) {
+    for (size_t s = 0; s < stages.size(); ++s) {
+        for (size_t idx : stages[s]) {
+            if (idx == system) {
+                return s;
+            }
+        }
+    }
+    return stages.size();
+}
+
+}  // namespace
+
+TEST(GameSystemSchedule, EnemyShootingSharesAStageWithExplosives) {
+    registry reg;
+    player_targets players;
+    engine::SystemManager manager;
+    manager.register_system(std::make_unique<ShootingSystem>());
+    manager.register_system(std::make_unique<WaveSystem>());
+    manager.register_system(std::make_unique<MovementSystem>());
+    manager.register_system(std::make_unique<EnemyShootingSystem>(&players));
+    manager.register_system(std::make_unique<ExplosiveProjectileSystem>());
+    manager.register_system(std::make_unique<CollisionSystem>());
+    manager.register_system(std::make_unique<CleanupSystem>());
+
+    const auto& stages = manager.stages(reg);
+    EXPECT_EQ(stage_of(stages, EnemyShooting), stage_of(stages, Explosive));
+    EXPECT_LT(stage_of(stages, Movement), stage_of(stages, EnemyShooting));
+    EXPECT_LT(stage_of(stages, Explosive), stage_of(stages, Collision));
+    EXPECT_LT(stage_of(stages, Collision), stage_of(stages, Cleanup));
+    EXPECT_LT(stage_of(stages, Cleanup), stages.size());
+}
+
+TEST(GameSystemSchedule, EnemyShootingWithoutSnapshotWaitsForExplosives) {
+    registry reg;
+    engine::SystemManager manager;
+    manager.register_system(std::make_unique<EnemyShootingSystem>());
+    manager.register_system(std::make_unique<ExplosiveProjectileSystem>());
+
+    EXPECT_EQ(manager.stages(reg).size(), 2u);
+}
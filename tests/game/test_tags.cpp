@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 #include "components/logic_components.hpp"
+#include "systems/cleanup_system.hpp"
+#include "systems/despawn_schedule.hpp"
+
+#include <vector>
 
 TEST(NetworkID, DefaultID) {
     network_id net_id;
@@ -62,3 +66,78 @@ TEST(ExplosionTag, ExplosionComplete) {
     
     EXPECT_GE(exp.elapsed, exp.lifetime);
 }
+
+TEST(DespawnSchedule, ExpiresInDeadlineOrderOnlyWhenDue) {
+    registry reg;
+    auto slow = reg.spawn_entity();
+    auto fast = reg.spawn_entity();
+    auto& schedule = despawn_schedule_of(reg);
+    schedule.expire_after(slow, 0.5f);
+    schedule.expire_after(fast, 0.25f);
+
+    std::vector<entity> expired;
+    schedule.collect_expired(0.2f, expired);
+    EXPECT_TRUE(expired.empty());
+
+    schedule.collect_expired(0.1f, expired);
+    ASSERT_EQ(expired.size(), 1u);
+    EXPECT_EQ(expired[0], fast);
+
+    schedule.expire_after(fast, 0.1f);
+    schedule.collect_expired(0.3f, expired);
+    ASSERT_EQ(expired.size(), 3u);
+    EXPECT_EQ(expired[1], fast);
+    EXPECT_EQ(expired[2], slow);
+    EXPECT_EQ(schedule.pending(), 0u);
+}
+
+TEST(DespawnSchedule, IsARegistrySingleton) {
+    registry reg;
+    despawn_schedule& first = despawn_schedule_of(reg);
+    first.flag_out_of_bounds(reg.spawn_entity());
+
+    EXPECT_EQ(&despawn_schedule_of(reg), &first);
+    EXPECT_EQ(despawn_schedule_of(reg).out_of_bounds().size(), 1u);
+    EXPECT_EQ(reg.get_components<despawn_schedule>().dense_size(), 1u);
+}
+
+TEST(DespawnSchedule, DeathsAreListedOnce) {
+    registry reg;
+    auto a = reg.spawn_entity();
+    auto b = reg.spawn_entity();
+    auto& schedule = despawn_schedule_of(reg);
+    schedule.flag_death(b);
+    schedule.flag_death(a);
+    schedule.flag_death(b);
+
+    EXPECT_EQ(schedule.unique_deaths(), (std::vector<entity>{a, b}));
+    schedule.clear_deaths();
+    EXPECT_TRUE(schedule.unique_deaths().empty());
+}
+
+TEST(DespawnSchedule, CleanupReapsOnlyFlaggedDeaths) {
+    registry reg;
+    auto flagged = reg.spawn_entity();
+    reg.add_component(flagged, health{0, 10});
+    auto unflagged = reg.spawn_entity();
+    reg.add_component(unflagged, health{0, 10});
+    auto healed = reg.spawn_entity();
+    reg.add_component(healed, health{5, 10});
+
+    auto& schedule = despawn_schedule_of(reg);
+    schedule.flag_death(flagged);
+    schedule.flag_death(healed);
+    cleanupSystem(reg, 0.016f);
+
+    EXPECT_FALSE(reg.is_alive(flagged));
+    EXPECT_TRUE(reg.is_alive(unflagged));
+    EXPECT_TRUE(reg.is_alive(healed));
+    EXPECT_TRUE(despawn_schedule_of(reg).unique_deaths().empty());
+}
+
+TEST(DespawnSchedule, EnemyBoundsContainProjectileBounds) {
+    position entering{2000.0f, 500.0f};
+    EXPECT_FALSE(despawn_schedule::inside_projectile_bounds(entering));
+    EXPECT_TRUE(despawn_schedule::inside_enemy_bounds(entering));
+    EXPECT_FALSE(despawn_schedule::inside_enemy_bounds(position{-1.0f, 500.0f}));
+}
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
+#include "components/game_components.hpp"
 #include "components/logic_components.hpp"
+#include "systems/player_targets.hpp"
 
 TEST(WeaponUpgradeType, EnumValues) {
     EXPECT_EQ(static_cast<uint8_t>(WeaponUpgradeType::None), 0);
@@ -82,3 +84,40 @@ TEST(Weapon, CustomWeaponConfig) {
     EXPECT_EQ(w.damage, 20);
     EXPECT_EQ(w.upgrade_type, WeaponUpgradeType::PowerShot);
 }
+
+TEST(CustomAttackConfig, ParsesPatternOnce) {
+    EXPECT_EQ(custom_attack_config::parse_pattern("targeted"), custom_attack_config::pattern::targeted);
+    EXPECT_EQ(custom_attack_config::parse_pattern("spread"), custom_attack_config::pattern::spread);
+    EXPECT_EQ(custom_attack_config::parse_pattern("front"), custom_attack_config::pattern::front);
+    EXPECT_EQ(custom_attack_config::parse_pattern("unknown"), custom_attack_config::pattern::front);
+}
+
+TEST(PlayerTargets, SkipsKnockedOutPlayersAndPicksNearest) {
+    registry reg;
+    auto add_player = [&](float x, float y, int hp) {
+        entity player = reg.spawn_entity();
+        reg.add_component(player, player_tag{});
+        reg.add_component(player, position{x, y});
+        reg.add_component(player, health{hp});
+        return player;
+    };
+    entity far = add_player(100.0f, 100.0f, 50);
+    add_player(900.0f, 500.0f, 0);
+    entity near = add_player(700.0f, 500.0f, 50);
+    entity enemy = reg.spawn_entity();
+    reg.add_component(enemy, position{1000.0f, 500.0f});
+
+    player_targets players;
+    players.refresh(reg);
+    ASSERT_EQ(players.all().size(), 2u);
+    EXPECT_EQ(players.all()[0].idx, far.id());
+
+    const auto* target = players.nearest(1000.0f, 500.0f);
+    ASSERT_NE(target, nullptr);
+    EXPECT_EQ(target->idx, near.id());
+
+    target = players.nearest(1000.0f, 500.0f, [](float dx, float) { return dx < -400.0f; });
+    ASSERT_NE(target, nullptr);
+    EXPECT_EQ(target->idx, far.id());
+    EXPECT_EQ(players.nearest(1000.0f, 500.0f, [](float dx, float) { return dx > 0.0f; }), nullptr);
+}
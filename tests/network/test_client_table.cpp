@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+#include "../../server/include/network/ClientTable.hpp"
+
+using namespace server;
+
+namespace {
+
+asio::ip::udp::endpoint local(unsigned short port) {
+    return asio::ip::udp::endpoint(asio::ip::make_address("127.0.0.1"), port);
+}
+
+}  // namespace
+
+TEST(ClientTableTest, FindsByIdAndEndpoint) {
+    ClientTable table;
+    table.add(local(5000), 1);
+    table.add(local(5001), 2);
+    table.add(asio::ip::udp::endpoint(asio::ip::make_address("::1"), 5000), 3);
+
+    ASSERT_NE(table.find(local(5001)), nullptr);
+    EXPECT_EQ(table.find(local(5001))->client_id, 2);
+    ASSERT_NE(table.find(3), nullptr);
+    EXPECT_EQ(table.find(3)->endpoint.port(), 5000);
+    EXPECT_EQ(table.find(local(5002)), nullptr);
+    EXPECT_EQ(table.find(4), nullptr);
+    EXPECT_EQ(table.size(), 3u);
+}
+
+TEST(ClientTableTest, EraseKeepsOtherRecordsReachable) {
+    ClientTable table;
+    for (int id = 1; id <= 4; ++id) {
+        table.add(local(static_cast<unsigned short>(5000 + id)), id);
+    }
+
+    EXPECT_TRUE(table.erase(2));
+    EXPECT_FALSE(table.erase(2));
+    EXPECT_EQ(table.size(), 3u);
+    EXPECT_EQ(table.find(2), nullptr);
+    EXPECT_EQ(table.find(local(5002)), nullptr);
+
+    for (int id : {1, 3, 4}) {
+        ClientEndpoint* by_id = table.find(id);
+        ASSERT_NE(by_id, nullptr);
+        EXPECT_EQ(by_id, table.find(local(static_cast<unsigned short>(5000 + id))));
+    }
+
+    EXPECT_TRUE(table.erase(4));
+    EXPECT_TRUE(table.erase(1));
+    EXPECT_TRUE(table.erase(3));
+    EXPECT_EQ(table.size(), 0u);
+}
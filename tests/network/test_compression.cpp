@@ -220,3 +220,25 @@ TEST(CompressionSerializer, LargePacket) {
         std::cout << "[TEST] ⚠️ Packet not compressed (LZ4 decided overhead not worth it)" << std::endl;
     }
 }
+
+TEST(CompressionSerializer, DecompressViewMatchesDecompress) {
+    std::vector<uint8_t> small = {0x42, 0xB5, 0x10, 0x01};
+    CompressionSerializer framed_small(small);
+    framed_small.compress();
+
+    std::vector<uint8_t> scratch;
+    auto view = CompressionSerializer::decompress_view(framed_small.data(), scratch);
+    EXPECT_EQ(view.data(), framed_small.data().data() + 1);
+    EXPECT_EQ(std::vector<uint8_t>(view.begin(), view.end()), small);
+    EXPECT_TRUE(scratch.empty());
+
+    std::vector<uint8_t> large(1024, 0xAB);
+    CompressionSerializer framed_large(large);
+    ASSERT_TRUE(framed_large.compress());
+    view = CompressionSerializer::decompress_view(framed_large.data(), scratch);
+    EXPECT_EQ(view.data(), scratch.data());
+    EXPECT_EQ(std::vector<uint8_t>(view.begin(), view.end()), large);
+
+    std::vector<uint8_t> bad = {0x07, 0x00};
+    EXPECT_THROW(CompressionSerializer::decompress_view(bad, scratch), CompressionException);
+}
@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+#include "../../server/include/network/OutboundQueue.hpp"
+
+using namespace server;
+
+TEST(OutboundQueueTest, BroadcastSharesOnePayload) {
+    OutboundQueue queue;
+    auto payload = std::make_shared<const std::vector<uint8_t>>(std::vector<uint8_t>{0x42, 0xB5, 0x13});
+
+    for (unsigned short port = 5000; port < 5004; ++port) {
+        queue.push(payload, asio::ip::udp::endpoint(asio::ip::make_address("127.0.0.1"), port));
+    }
+
+    std::vector<OutboundDatagram> batch;
+    ASSERT_TRUE(queue.take(batch));
+    ASSERT_EQ(batch.size(), 4u);
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+        EXPECT_EQ(batch[i].payload.get(), payload.get());
+        EXPECT_EQ(batch[i].endpoint.port(), 5000 + i);
+    }
+    EXPECT_EQ(payload.use_count(), 5);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(OutboundQueueTest, TakeReplacesPreviousBatch) {
+    OutboundQueue queue;
+    asio::ip::udp::endpoint endpoint(asio::ip::make_address("127.0.0.1"), 4242);
+    auto first = std::make_shared<const std::vector<uint8_t>>(std::vector<uint8_t>{1});
+    auto second = std::make_shared<const std::vector<uint8_t>>(std::vector<uint8_t>{2});
+
+    std::vector<OutboundDatagram> batch;
+    EXPECT_FALSE(queue.take(batch));
+
+    queue.push(first, endpoint);
+    ASSERT_TRUE(queue.take(batch));
+    queue.push(second, endpoint);
+    ASSERT_TRUE(queue.take(batch));
+
+    ASSERT_EQ(batch.size(), 1u);
+    EXPECT_EQ(batch[0].payload, second);
+    EXPECT_EQ(first.use_count(), 1);
+}
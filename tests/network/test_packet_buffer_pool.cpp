@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+#include "../../server/include/network/PacketBufferPool.hpp"
+
+#include <set>
+
+using namespace server;
+
+TEST(PacketBufferPoolTest, LeasesDistinctSlabsUntilExhausted) {
+    PacketBufferPool pool(4, 64);
+
+    std::set<uint8_t*> seen;
+    std::vector<std::span<uint8_t>> slabs;
+    for (int i = 0; i < 4; ++i) {
+        auto slab = pool.acquire();
+        ASSERT_EQ(slab.size(), 64u);
+        EXPECT_TRUE(seen.insert(slab.data()).second);
+        slabs.push_back(slab);
+    }
+
+    EXPECT_EQ(pool.available(), 0u);
+    EXPECT_TRUE(pool.acquire().empty());
+
+    for (auto slab : slabs) {
+        pool.release(slab);
+    }
+    EXPECT_EQ(pool.available(), pool.capacity());
+}
+
+TEST(PacketBufferPoolTest, ReleasedSlabIsReused) {
+    PacketBufferPool pool(2, 128);
+
+    auto first = pool.acquire();
+    first[0] = 0x42;
+    pool.release(first);
+
+    auto again = pool.acquire();
+    EXPECT_EQ(again.data(), first.data());
+    EXPECT_EQ(again[0], 0x42);
+
+    pool.release({});
+    EXPECT_EQ(pool.available(), 1u);
+}
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+#include "../../src/Common/RingBuffer.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace RType;
+
+TEST(SpscRingTest, RoundsCapacityAndCountsDrops) {
+    SpscRing<int> ring(5);
+    EXPECT_EQ(ring.capacity(), 8u);
+
+    for (int i = 0; i < 10; ++i) {
+        ring.push(i);
+    }
+    EXPECT_EQ(ring.size(), 8u);
+    EXPECT_EQ(ring.dropped(), 2u);
+
+    int value = -1;
+    ASSERT_TRUE(ring.try_pop(value));
+    EXPECT_EQ(value, 0);
+    EXPECT_TRUE(ring.push(10));
+}
+
+TEST(SpscRingTest, PopNKeepsOrderAcrossWrap) {
+    SpscRing<std::string> ring(4);
+    std::vector<std::string> out;
+
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 3; ++i) {
+            ASSERT_TRUE(ring.push(std::to_string(round * 3 + i)));
+        }
+        out.clear();
+        EXPECT_EQ(ring.pop_n(out, 2), 2u);
+        EXPECT_EQ(ring.pop_n(out, 8), 1u);
+        EXPECT_EQ(out, (std::vector<std::string>{std::to_string(round * 3),
+                                                 std::to_string(round * 3 + 1),
+                                                 std::to_string(round * 3 + 2)}));
+    }
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(SpscRingTest, ThreadedTransferIsInOrder) {
+    SpscRing<int> ring(64);
+    const int count = 100000;
+
+    std::thread producer([&ring, count]() {
+        for (int i = 0; i < count; ++i) {
+            while (!ring.push(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::vector<int> out;
+    int expected = 0;
+    bool in_order = true;
+    while (expected < count) {
+        out.clear();
+        ring.pop_n(out, 16);
+        for (int value : out) {
+            in_order = in_order && value == expected;
+            ++expected;
+        }
+    }
+    producer.join();
+
+    EXPECT_TRUE(in_order);
+}
+
+TEST(MpscRingTest, ManyProducersDeliverEverything) {
+    MpscRing<int> ring(256);
+    const int producers = 4;
+    const int per_producer = 20000;
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&ring, p, per_producer]() {
+            for (int i = 0; i < per_producer; ++i) {
+                while (!ring.push(p * per_producer + i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<int> last(producers, -1);
+    bool per_producer_order = true;
+    int received = 0;
+    std::vector<int> out;
+    while (received < producers * per_producer) {
+        out.clear();
+        received += static_cast<int>(ring.pop_n(out, 32));
+        for (int value : out) {
+            auto p = static_cast<std::size_t>(value / per_producer);
+            per_producer_order = per_producer_order && value > last[p];
+            last[p] = value;
+        }
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_TRUE(per_producer_order);
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(MpscRingTest, WaitAndPopWakesOnPush) {
+    MpscRing<std::string> ring(8);
+
+    std::thread consumer_wakeup([&ring]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        ring.push("disconnect");
+    });
+
+    std::string value;
+    ring.wait_and_pop(value);
+    consumer_wakeup.join();
+
+    EXPECT_EQ(value, "disconnect");
+}
+
+TEST(MpscRingTest, FullRingDropsAndDestroysLeftovers) {
+    auto tracked = std::make_shared<int>(0);
+    {
+        MpscRing<std::shared_ptr<int>> ring(2);
+        EXPECT_TRUE(ring.push(tracked));
+        EXPECT_TRUE(ring.push(tracked));
+        EXPECT_FALSE(ring.push(tracked));
+        EXPECT_EQ(ring.dropped(), 1u);
+        EXPECT_EQ(tracked.use_count(), 3);
+    }
+    EXPECT_EQ(tracked.use_count(), 1);
+}
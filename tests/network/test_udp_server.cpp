@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include "../../server/include/network/UDPServer.hpp"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+using namespace server;
+
+namespace {
+
+constexpr uint8_t UNRELIABLE_OPCODE = 0x10;
+constexpr uint8_t RELIABLE_OPCODE = 0x02;
+
+// Runs the server's first shard on a thread, as the game server does.
+class UDPServerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        server_ = std::make_unique<UDPServer>(context_, "127.0.0.1", 0, 2);
+        network_thread_ = std::thread([this]() { server_->run_network_loop(); });
+    }
+
+    void TearDown() override {
+        server_->stop();
+        network_thread_.join();
+        server_.reset();
+    }
+
+    asio::ip::udp::endpoint server_endpoint() const {
+        return asio::ip::udp::endpoint(asio::ip::make_address("127.0.0.1"), server_->get_port());
+    }
+
+    std::unique_ptr<asio::ip::udp::socket> open_client() {
+        auto socket = std::make_unique<asio::ip::udp::socket>(client_context_);
+        socket->open(asio::ip::udp::v4());
+        socket->bind(asio::ip::udp::endpoint(asio::ip::make_address("127.0.0.1"), 0));
+        socket->non_blocking(true);
+        return socket;
+    }
+
+    // Drains the server until @p count packets arrived or a second went by.
+    std::vector<NetworkPacket> receive_packets(std::size_t count) {
+        std::vector<NetworkPacket> received;
+        std::vector<NetworkPacket> batch;
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+        while (received.size() < count && std::chrono::steady_clock::now() < deadline) {
+            server_->get_input_packets(batch);
+            received.insert(received.end(), batch.begin(), batch.end());
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return received;
+    }
+
+    // The next datagram on @p socket and who sent it, if one arrives within a second.
+    std::optional<std::vector<uint8_t>> receive_reply(asio::ip::udp::socket& socket,
+                                                      asio::ip::udp::endpoint& from) {
+        std::vector<uint8_t> buffer(UDPServer::MAX_DATAGRAM);
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+        while (std::chrono::steady_clock::now() < deadline) {
+            boost::system::error_code ec;
+            std::size_t size = socket.receive_from(asio::buffer(buffer), from, 0, ec);
+            if (!ec) {
+                buffer.resize(size);
+                return buffer;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return std::nullopt;
+    }
+
+    asio::io_context context_;
+    asio::io_context client_context_;
+    std::unique_ptr<UDPServer> server_;
+    std::thread network_thread_;
+};
+
+}  // namespace
+
+TEST_F(UDPServerTest, DeliversEveryDatagramInPerClientOrder) {
+    constexpr std::size_t CLIENTS = 4;
+    constexpr uint8_t PACKETS_PER_CLIENT = 25;
+    ASSERT_EQ(server_->get_shard_count(), 2u);
+
+    std::vector<std::unique_ptr<asio::ip::udp::socket>> clients;
+    std::map<unsigned short, std::size_t> client_of_port;
+    for (std::size_t i = 0; i < CLIENTS; ++i) {
+        clients.push_back(open_client());
+        client_of_port[clients.back()->local_endpoint().port()] = i;
+    }
+
+    for (uint8_t seq = 0; seq < PACKETS_PER_CLIENT; ++seq) {
+        for (std::size_t i = 0; i < CLIENTS; ++i) {
+            std::vector<uint8_t> datagram = {0x42, 0xB5, UNRELIABLE_OPCODE,
+                                             static_cast<uint8_t>(i), seq, 0x00, 0x00};
+            clients[i]->send_to(asio::buffer(datagram), server_endpoint());
+        }
+    }
+
+    auto packets = receive_packets(CLIENTS * PACKETS_PER_CLIENT);
+    ASSERT_EQ(packets.size(), CLIENTS * PACKETS_PER_CLIENT);
+
+    std::vector<uint8_t> next_seq(CLIENTS, 0);
+    std::map<std::size_t, int> id_of_client;
+    for (const auto& packet : packets) {
+        ASSERT_EQ(packet.data.size(), 7u);
+        ASSERT_EQ(client_of_port.count(packet.sender.port()), 1u);
+        std::size_t client = client_of_port[packet.sender.port()];
+        EXPECT_EQ(packet.data[3], client);
+        EXPECT_EQ(packet.data[4], next_seq[client]++);
+
+        EXPECT_NE(packet.client_id, 0);
+        auto it = id_of_client.emplace(client, packet.client_id).first;
+        EXPECT_EQ(it->second, packet.client_id);
+    }
+    EXPECT_EQ(id_of_client.size(), CLIENTS);
+    EXPECT_EQ(server_->get_client_count(), CLIENTS);
+
+    // Replies leave from the bound port, whichever shard the client is pinned to.
+    std::vector<uint8_t> reply = {0x42, 0xB5, UNRELIABLE_OPCODE};
+    for (const auto& [client, client_id] : id_of_client) {
+        server_->send_to_client(client_id, reply);
+    }
+    server_->flush_output();
+
+    for (const auto& [client, client_id] : id_of_client) {
+        asio::ip::udp::endpoint from;
+        auto received = receive_reply(*clients[client], from);
+        ASSERT_TRUE(received.has_value()) << "no reply for client " << client_id;
+        EXPECT_EQ(*received, reply);
+        EXPECT_EQ(from, server_endpoint());
+    }
+}
+
+TEST_F(UDPServerTest, AcksReliablePacketsFromTheBoundPort) {
+    auto client = open_client();
+    std::vector<uint8_t> datagram = {0x42, 0xB5, RELIABLE_OPCODE, 0x01, 0x00, 0x00, 0x00, 0xAB};
+    client->send_to(asio::buffer(datagram), server_endpoint());
+
+    asio::ip::udp::endpoint from;
+    auto ack = receive_reply(*client, from);
+    ASSERT_TRUE(ack.has_value());
+    EXPECT_EQ(*ack, (std::vector<uint8_t>{0x42, 0xB5, 0x60, 0x01, 0x00, 0x00, 0x00}));
+    EXPECT_EQ(from, server_endpoint());
+
+    // The sequence id is stripped before the packet reaches the game thread.
+    auto packets = receive_packets(1);
+    ASSERT_EQ(packets.size(), 1u);
+    EXPECT_EQ(packets[0].data, (std::vector<uint8_t>{0x42, 0xB5, RELIABLE_OPCODE, 0xAB}));
+    EXPECT_NE(packets[0].client_id, 0);
+}